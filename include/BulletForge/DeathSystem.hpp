@@ -5,17 +5,23 @@
 
 #include <entt/fwd.hpp>
 
+namespace Sce
+{
+	class EntityCommandBuffer;
+}
+
 namespace BulletForge
 {
 	class DeathSystem
 	{
 	public :
-		DeathSystem(entt::registry* registry);
+		DeathSystem(entt::registry* registry, Sce::EntityCommandBuffer* commandBuffer);
 
 		void DeathNote();
 
 	private:
 		entt::registry* m_registry;
+		Sce::EntityCommandBuffer* m_commandBuffer;
 	};
 }
 
@@ -5,6 +5,19 @@
 #include <SuperCoco/Renderer.hpp>
 #include <SuperCoco/Sprite.hpp>
 #include <SuperCoco/Core.hpp>
+#include <SuperCoco/EntityCommandBuffer.hpp>
+#include <SuperCoco/EntityPool.hpp>
+#include <SuperCoco/Prefab.hpp>
+#include <map>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Sce
+{
+	class ComponentRegistry;
+}
 
 namespace BulletForge
 {
@@ -20,7 +33,7 @@ namespace BulletForge
 	class Game
 	{
 	public:
-		Game();
+		explicit Game(const Sce::ComponentRegistry& componentRegistry);
 		~Game();
 		Game(Game&) = delete;
 		Game(Game&&) noexcept = delete;
@@ -31,13 +44,28 @@ namespace BulletForge
 		entt::handle CreatePlayer(entt::registry& world, Sce::Renderer& renderer, Sce::Vector2f position, int layer);
 		entt::handle CreateTile(entt::registry& world, Sce::Renderer& renderer, SDL_Rect rect, Sce::Vector2f position, Sce::Vector2f origin, int layer);
 		entt::handle CreateWeapon(entt::registry& world, Sce::Renderer& renderer, SDL_Rect rect, Sce::Vector2f position, Sce::Vector2f origin, int layer);
-		entt::handle CreateEnemy(entt::registry& world, Sce::Renderer& renderer, EnemyType type, Sce::Vector2f position, int layer, Sce::Core& core);
+		entt::handle CreateEnemy(entt::registry& world, Sce::Renderer& renderer, EnemyType type, Sce::Vector2f position, int layer, Sce::Core& core, Sce::EntityCommandBuffer& commandBuffer);
+		// Crée une vague d'ennemis du même type en un seul lot, en recyclant d'abord les ennemis morts
+		std::vector<entt::entity> CreateEnemies(entt::registry& world, Sce::Renderer& renderer, EnemyType type, std::span<const Sce::Vector2f> positions, int layer, Sce::Core& core, Sce::EntityCommandBuffer& commandBuffer);
+		entt::handle CreateHitText(entt::registry& world, Sce::Core& core, const Sce::Vector2f& position);
+
+		Sce::EntityPool::Stats GetEnemyPoolStats() const;
+		Sce::EntityPool::Stats GetHitTextPoolStats() const;
 
 		static Game& Instance();
 
 	private:
 		std::shared_ptr<Sce::Sprite> BuildPlayerSprite(Sce::Renderer& renderer, int layer);
 		std::shared_ptr<Sce::Sprite> BuildTileSprite(Sce::Renderer& renderer, SDL_Rect rect, Sce::Vector2f origin, int layer);
+		// Prototype d'ennemi (Transform + sprite) construit au premier appel pour chaque type et couche
+		const Sce::Prefab& GetEnemyPrefab(Sce::Renderer& renderer, EnemyType type, int layer);
+		Sce::EntityPool& GetEnemyPool(entt::registry& world, Sce::Renderer& renderer, EnemyType type, int layer, Sce::Core& core, Sce::EntityCommandBuffer& commandBuffer);
+
+		std::map<std::pair<EnemyType, int>, Sce::Prefab> m_enemyPrefabs;
+		// Les pools sont détruits avant les prefabs qu'ils instancient
+		std::map<std::pair<EnemyType, int>, Sce::EntityPool> m_enemyPools;
+		std::optional<Sce::EntityPool> m_hitTextPool;
+		const Sce::ComponentRegistry& m_componentRegistry;
 
 		static Game* s_instance;
 	};
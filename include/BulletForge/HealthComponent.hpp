@@ -16,6 +16,8 @@ namespace BulletForge
 		float GetHealth() const;
 
 		void ModifyHealth(float value);
+		// Remet la vie au maximum, pour un ennemi recyclé
+		void Restore();
 		void SetOnDeathCallback(std::function<void()> callback);
 	private:
 
@@ -0,0 +1,55 @@
+#pragma once
+
+#ifndef SUPER_COCO_AFFINE2_HPP
+#define SUPER_COCO_AFFINE2_HPP
+
+#include <SuperCoco/Vector2.hpp>
+#include <string>
+
+namespace Sce
+{
+	// Matrice 3x3 affine (la dernière ligne vaut toujours 0 0 1), stockée sur la pile
+	// contrairement à Matrix<T> qui passe par un std::vector : aucune allocation dans les chemins de rendu
+	//
+	// | a  b  tx |
+	// | c  d  ty |
+	// | 0  0  1  |
+	template<typename T>
+	struct Affine2
+	{
+		T a, b, tx;
+		T c, d, ty;
+
+		constexpr Affine2();
+		constexpr Affine2(T A, T B, T TX, T C, T D, T TY);
+
+		constexpr Affine2 operator*(const Affine2& other) const;
+		Vector2<T> operator*(const Vector2<T>& point) const;
+
+		constexpr Affine2& operator*=(const Affine2& other);
+
+		constexpr bool operator==(const Affine2& other) const;
+		constexpr bool operator!=(const Affine2& other) const;
+
+		T operator[](Vector2i coords) const;
+
+		constexpr T GetDeterminant() const;
+		constexpr Affine2 GetInverse() const;
+		Vector2<T> GetTranslation() const;
+
+		std::string ToString() const;
+
+		Vector2<T> TransformPoint(const Vector2<T>& point) const;
+		Vector2<T> TransformVector(const Vector2<T>& vector) const;
+
+		static constexpr Affine2 Identity();
+		static Affine2 MakeFromPosition(const Vector2<T>& position);
+		static Affine2 MakeTransform(const Vector2<T>& position, float rotation, const Vector2<T>& scale);
+	};
+
+	using Affine2f = Affine2<float>;
+}
+
+#include <SuperCoco/Affine2.inl>
+
+#endif
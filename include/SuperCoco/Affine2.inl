@@ -0,0 +1,149 @@
+#include <SuperCoco/Maths.hpp>
+#include <cassert>
+#include <cmath>
+
+namespace Sce
+{
+	template<typename T>
+	constexpr Affine2<T>::Affine2() :
+	a(1), b(0), tx(0),
+	c(0), d(1), ty(0)
+	{
+	}
+
+	template<typename T>
+	constexpr Affine2<T>::Affine2(T A, T B, T TX, T C, T D, T TY) :
+	a(A), b(B), tx(TX),
+	c(C), d(D), ty(TY)
+	{
+	}
+
+	template<typename T>
+	constexpr Affine2<T> Affine2<T>::operator*(const Affine2& other) const
+	{
+		return Affine2{
+			a * other.a + b * other.c, a * other.b + b * other.d, a * other.tx + b * other.ty + tx,
+			c * other.a + d * other.c, c * other.b + d * other.d, c * other.tx + d * other.ty + ty
+		};
+	}
+
+	template<typename T>
+	Vector2<T> Affine2<T>::operator*(const Vector2<T>& point) const
+	{
+		return TransformPoint(point);
+	}
+
+	template<typename T>
+	constexpr Affine2<T>& Affine2<T>::operator*=(const Affine2& other)
+	{
+		*this = *this * other;
+		return *this;
+	}
+
+	template<typename T>
+	constexpr bool Affine2<T>::operator==(const Affine2& other) const
+	{
+		return a == other.a && b == other.b && tx == other.tx &&
+		       c == other.c && d == other.d && ty == other.ty;
+	}
+
+	template<typename T>
+	constexpr bool Affine2<T>::operator!=(const Affine2& other) const
+	{
+		return !operator==(other);
+	}
+
+	template<typename T>
+	T Affine2<T>::operator[](Vector2i coords) const
+	{
+		assert(coords.x < 3);
+		assert(coords.y < 3);
+
+		switch (coords.x)
+		{
+			case 0: return (coords.y == 0) ? a : (coords.y == 1) ? b : tx;
+			case 1: return (coords.y == 0) ? c : (coords.y == 1) ? d : ty;
+			default: return (coords.y == 2) ? T(1) : T(0);
+		}
+	}
+
+	template<typename T>
+	constexpr T Affine2<T>::GetDeterminant() const
+	{
+		return a * d - b * c;
+	}
+
+	template<typename T>
+	constexpr Affine2<T> Affine2<T>::GetInverse() const
+	{
+		// Inverse analytique : on inverse la partie 2x2 puis on ramène la translation dans le nouveau repère
+		T det = GetDeterminant();
+		if (det == T(0))
+			return Affine2{};
+
+		T invDet = T(1) / det;
+		T ia = d * invDet;
+		T ib = -b * invDet;
+		T ic = -c * invDet;
+		T id = a * invDet;
+
+		return Affine2{
+			ia, ib, -(ia * tx + ib * ty),
+			ic, id, -(ic * tx + id * ty)
+		};
+	}
+
+	template<typename T>
+	Vector2<T> Affine2<T>::GetTranslation() const
+	{
+		return Vector2<T>(tx, ty);
+	}
+
+	template<typename T>
+	std::string Affine2<T>::ToString() const
+	{
+		return "| " + std::to_string(a) + " " + std::to_string(b) + " " + std::to_string(tx) + "  |\n" +
+		       "| " + std::to_string(c) + " " + std::to_string(d) + " " + std::to_string(ty) + "  |\n" +
+		       "| 0 0 1  |\n";
+	}
+
+	template<typename T>
+	Vector2<T> Affine2<T>::TransformPoint(const Vector2<T>& point) const
+	{
+		return Vector2<T>(a * point.x + b * point.y + tx, c * point.x + d * point.y + ty);
+	}
+
+	template<typename T>
+	Vector2<T> Affine2<T>::TransformVector(const Vector2<T>& vector) const
+	{
+		return Vector2<T>(a * vector.x + b * vector.y, c * vector.x + d * vector.y);
+	}
+
+	template<typename T>
+	constexpr Affine2<T> Affine2<T>::Identity()
+	{
+		return Affine2{};
+	}
+
+	template<typename T>
+	Affine2<T> Affine2<T>::MakeFromPosition(const Vector2<T>& position)
+	{
+		return Affine2{
+			1, 0, position.x,
+			0, 1, position.y
+		};
+	}
+
+	template<typename T>
+	Affine2<T> Affine2<T>::MakeTransform(const Vector2<T>& position, float rotation, const Vector2<T>& scale)
+	{
+		// Équivalent de Matrix<T>::MakeTransform3x3 (translation * rotation * échelle) développé à la main
+		T cosAngle = static_cast<T>(std::cos(Deg2Rad * rotation));
+		T sinAngle = static_cast<T>(std::sin(Deg2Rad * rotation));
+
+		return Affine2{
+			cosAngle * scale.x, -sinAngle * scale.y, position.x,
+			sinAngle * scale.x,  cosAngle * scale.y, position.y
+		};
+	}
+}
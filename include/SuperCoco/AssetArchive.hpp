@@ -0,0 +1,81 @@
+#ifndef SUPERCOCO_ASSETARCHIVE_HPP
+#define SUPERCOCO_ASSETARCHIVE_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <SuperCoco/MappedFile.hpp>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Sce
+{
+	// Archive regroupant des ressources dans un seul fichier (.scpak), projeté en mémoire à l'ouverture.
+	//
+	// | Header | TocEntry[entryCount] (triées par hash) | table des chemins | données (alignées sur 16 octets) |
+	//
+	// Les fichiers stockés tels quels sont lus sans aucune copie, ceux compressés en LZ4 sont décompressés
+	// directement depuis la projection dans le buffer fourni par l'appelant.
+	class SUPER_COCO_API AssetArchive
+	{
+	public:
+		AssetArchive(const AssetArchive&) = delete;
+		AssetArchive(AssetArchive&&) noexcept = default;
+		~AssetArchive() = default;
+
+		bool Contains(const std::string& filepath) const;
+
+		std::size_t GetEntryCount() const;
+		std::vector<std::string> GetPaths() const;
+
+		// Renvoie le contenu du fichier : une vue sur la projection s'il est stocké tel quel (buffer n'est pas touché),
+		// une vue sur buffer s'il est compressé, rien s'il est absent de l'archive
+		std::optional<std::span<const std::uint8_t>> Read(const std::string& filepath, std::vector<std::uint8_t>& buffer) const;
+
+		AssetArchive& operator=(const AssetArchive&) = delete;
+		AssetArchive& operator=(AssetArchive&&) noexcept = default;
+
+		static bool BuildToFile(const std::vector<std::string>& filepaths, const std::string& archivePath, bool compressTextFiles = true);
+		static AssetArchive Open(const std::string& archivePath);
+
+		static std::uint64_t HashPath(const std::string& filepath);
+		static std::string NormalizePath(const std::string& filepath);
+
+	private:
+		enum EntryFlags : std::uint32_t
+		{
+			EntryFlag_LZ4 = 1 << 0
+		};
+
+		struct Header
+		{
+			char magic[4];
+			std::uint32_t version;
+			std::uint32_t entryCount;
+			std::uint32_t pathTableSize;
+		};
+
+		struct TocEntry
+		{
+			std::uint64_t pathHash;
+			std::uint64_t dataOffset;
+			std::uint64_t storedSize;
+			std::uint64_t originalSize;
+			std::uint32_t pathOffset; //< position du chemin (terminé par \0) dans la table des chemins
+			std::uint32_t flags;
+		};
+
+		explicit AssetArchive(MappedFile mappedFile);
+
+		const TocEntry* FindEntry(const std::string& filepath) const;
+
+		MappedFile m_mappedFile;
+		std::span<const TocEntry> m_entries;
+		std::span<const char> m_pathTable;
+	};
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef SUPERCOCO_ASSETHANDLE_HPP
+#define SUPERCOCO_ASSETHANDLE_HPP
+
+#pragma once
+
+#include <memory>
+
+namespace Sce
+{
+	class ResourceManager;
+
+	enum class AssetStatus
+	{
+		Loading,
+		Loaded,
+		Failed
+	};
+
+	// Référence vers une ressource chargée en arrière-plan par le ResourceManager.
+	// Get() renvoie la ressource "manquante" tant que le chargement n'est pas terminé (ou s'il a échoué),
+	// l'état n'est modifié que par ResourceManager::Update() donc depuis le thread principal uniquement.
+	template<typename T>
+	class AssetHandle
+	{
+		friend ResourceManager;
+
+	public:
+		AssetHandle() = default;
+
+		const std::shared_ptr<T>& Get() const;
+		AssetStatus GetStatus() const;
+
+		bool IsReady() const;
+		bool IsValid() const;
+
+	private:
+		struct State
+		{
+			std::shared_ptr<T> asset;
+			std::shared_ptr<T> placeholder;
+			AssetStatus status = AssetStatus::Loading;
+		};
+
+		explicit AssetHandle(std::shared_ptr<State> state);
+
+		std::shared_ptr<State> m_state;
+	};
+}
+
+#include <SuperCoco/AssetHandle.inl>
+
+#endif
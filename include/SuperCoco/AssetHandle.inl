@@ -0,0 +1,42 @@
+namespace Sce
+{
+	template<typename T>
+	AssetHandle<T>::AssetHandle(std::shared_ptr<State> state) :
+	m_state(std::move(state))
+	{
+	}
+
+	template<typename T>
+	const std::shared_ptr<T>& AssetHandle<T>::Get() const
+	{
+		static const std::shared_ptr<T> empty;
+		if (!m_state)
+			return empty;
+
+		if (m_state->status == AssetStatus::Loaded)
+			return m_state->asset;
+
+		return m_state->placeholder;
+	}
+
+	template<typename T>
+	AssetStatus AssetHandle<T>::GetStatus() const
+	{
+		if (!m_state)
+			return AssetStatus::Failed;
+
+		return m_state->status;
+	}
+
+	template<typename T>
+	bool AssetHandle<T>::IsReady() const
+	{
+		return GetStatus() != AssetStatus::Loading;
+	}
+
+	template<typename T>
+	bool AssetHandle<T>::IsValid() const
+	{
+		return m_state != nullptr;
+	}
+}
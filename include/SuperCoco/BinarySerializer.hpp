@@ -3,54 +3,100 @@
 
 #pragma once
 
-#include <iostream>
-#include <cstdlib>
+#include <SuperCoco/Export.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Sce
 {
-	template<typename T>
-	void SerializeBinary(std::vector<uint8_t>& byteArray, T value)
-	{
-		std::size_t offset = byteArray.size();
-		byteArray.resize(offset + sizeof(value));
-		std::memcpy(&byteArray[offset], &value, sizeof(value));
-	}
+	// Les valeurs sont écrites telles qu'en mémoire (endianness de la machine), les longueurs en varint (LEB128)
+	constexpr std::size_t DefaultBinaryChunkSize = 64 * 1024;
 
-	template<typename T>
-	void SerializeBinary(std::vector<uint8_t>& byteArray, const std::string& value)
+	// Écrit dans un buffer en mémoire, ou dans un flux par blocs de taille fixe : dans ce cas seul un bloc est gardé en mémoire
+	class SUPER_COCO_API BinaryWriter
 	{
-		SerializeBinary<std::uint16_t>(byteArray, value.size());
+	public:
+		BinaryWriter();
+		explicit BinaryWriter(std::ostream& stream, std::size_t chunkSize = DefaultBinaryChunkSize);
+		BinaryWriter(const BinaryWriter&) = delete;
+		BinaryWriter(BinaryWriter&&) = delete;
+		~BinaryWriter();
 
-		std::size_t offset = byteArray.size();
-		byteArray.resize(offset + value.size());
-		std::memcpy(&byteArray[offset], &value[0], value.size());
-	}
+		// Envoie les données en attente dans le flux (sans effet en mémoire)
+		void Flush();
 
-	template<typename T>
-	T UnserializeBinary(const std::vector<std::uint8_t>& byteArray, std::size_t& offset)
-	{
-		T value;
-		std::memcpy(&value, &byteArray[offset], sizeof(T));
-		offset += sizeof(T);
+		// Données écrites, uniquement en mémoire
+		std::span<const std::uint8_t> GetData() const;
+		std::uint64_t GetPosition() const;
+
+		void Reserve(std::size_t size);
+
+		std::vector<std::uint8_t> TakeData();
+
+		template<typename T> void Write(const T& value);
+		void WriteBytes(const void* data, std::size_t size);
+		void WritePadding(std::size_t alignment);
+		template<typename T> void WriteSpan(std::span<const T> values);
+		void WriteString(std::string_view value);
+		void WriteVarUInt(std::uint64_t value);
+
+		BinaryWriter& operator=(const BinaryWriter&) = delete;
+		BinaryWriter& operator=(BinaryWriter&&) = delete;
 
-		return value;
-	}
+	private:
+		std::uint8_t* Allocate(std::size_t size);
 
-	template<>
-	std::string UnserializeBinary(const std::vector<std::uint8_t>& byteArray, std::size_t& offset)
+		std::vector<std::uint8_t> m_buffer; //< seuls les m_size premiers octets sont utilisés
+		std::ostream* m_stream;
+		std::size_t m_chunkSize;
+		std::size_t m_size;
+		std::uint64_t m_flushedSize;
+	};
+
+	// Lit depuis un buffer en mémoire (sans copie) ou depuis un flux par blocs de taille fixe.
+	// Toute lecture au-delà de la fin des données lance une std::runtime_error au lieu de lire n'importe quoi.
+	class SUPER_COCO_API BinaryReader
 	{
-		std::uint16_t strLength = UnserializeBinary<std::uint16_t>(byteArray, offset);
+	public:
+		explicit BinaryReader(std::span<const std::uint8_t> data);
+		explicit BinaryReader(std::istream& stream, std::size_t chunkSize = DefaultBinaryChunkSize);
+		BinaryReader(const BinaryReader&) = delete;
+		BinaryReader(BinaryReader&&) = delete;
+		~BinaryReader() = default;
+
+		std::uint64_t GetPosition() const;
+		std::size_t GetRemainingSize() const;
+
+		bool IsAtEnd();
+
+		template<typename T> T Read();
+		void ReadBytes(void* data, std::size_t size);
+		template<typename T> void ReadSpan(std::span<T> values);
+		std::string ReadString();
+		std::uint64_t ReadVarUInt();
+
+		void Skip(std::size_t size);
+		void SkipPadding(std::size_t alignment);
 
-		std::string value(strLength, '\0');
-		std::memcpy(&value[0], &byteArray[offset], strLength);
-		offset += strLength;
+		BinaryReader& operator=(const BinaryReader&) = delete;
+		BinaryReader& operator=(BinaryReader&&) = delete;
 
-		return value;
-	}
+	private:
+		std::size_t Refill();
 
+		std::vector<std::uint8_t> m_chunk;
+		std::span<const std::uint8_t> m_data; //< données disponibles : tout le buffer en mémoire, le bloc courant en flux
+		std::istream* m_stream;
+		std::size_t m_offset;
+		std::uint64_t m_consumedSize; //< octets des blocs précédents
+	};
 }
 
+#include <SuperCoco/BinarySerializer.inl>
 
-#endif
\ No newline at end of file
+#endif
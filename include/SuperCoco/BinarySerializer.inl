@@ -0,0 +1,40 @@
+#include <cstring>
+#include <type_traits>
+
+namespace Sce
+{
+	template<typename T>
+	void BinaryWriter::Write(const T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types can be written as is");
+
+		std::memcpy(Allocate(sizeof(T)), &value, sizeof(T));
+	}
+
+	template<typename T>
+	void BinaryWriter::WriteSpan(std::span<const T> values)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types can be written as is");
+
+		WriteBytes(values.data(), values.size_bytes());
+	}
+
+	template<typename T>
+	T BinaryReader::Read()
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types can be read as is");
+
+		T value;
+		ReadBytes(&value, sizeof(T));
+
+		return value;
+	}
+
+	template<typename T>
+	void BinaryReader::ReadSpan(std::span<T> values)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable types can be read as is");
+
+		ReadBytes(values.data(), values.size_bytes());
+	}
+}
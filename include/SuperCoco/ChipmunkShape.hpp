@@ -1,7 +1,7 @@
 #pragma once
 
 #include <SuperCoco/Export.hpp>
-#include <SuperCoco/Matrix.hpp>
+#include <SuperCoco/Affine2.hpp>
 #include <SuperCoco/Vector2.hpp>
 #include <chipmunk/chipmunk.h>
 #include <vector>
@@ -34,14 +34,14 @@ namespace Sce
 			static ChipmunkShape BuildBox(ChipmunkBody& body, float left, float bottom, float right, float top, float radius = 0.f);
 			static ChipmunkShape BuildBox(ChipmunkBody& body, const Vector2f& topLeftCorner, const Vector2f& bottomRightCorner, float radius = 0.f);
 			static ChipmunkShape BuildCircle(ChipmunkBody& body, float radius, const Vector2f& offset = Vector2f(0.f, 0.f));
-			static ChipmunkShape BuildConvexHull(ChipmunkBody& body, const std::vector<Vector2f>& positions, const Matrixf& transform = Matrixf::Identity(3.f), float radius = 0.f);
+			static ChipmunkShape BuildConvexHull(ChipmunkBody& body, const std::vector<Vector2f>& positions, const Affine2f& transform = Affine2f::Identity(), float radius = 0.f);
 			static ChipmunkShape BuildSegment(ChipmunkBody& body, const Vector2f& from, const Vector2f& to, float radius = 0.f);
 
 			static float ComputeBoxMoment(float mass, float width, float height);
 			static float ComputeBoxMoment(float mass, float left, float bottom, float right, float top);
 			static float ComputeBoxMoment(float mass, const Vector2f& topLeftCorner, const Vector2f& bottomRightCorner);
 			static float ComputeCircleMoment(float mass, float radius, const Vector2f& offset = Vector2f(0.f, 0.f));
-			static float ComputePolyMoment(float mass, const std::vector<Vector2f>& positions, const Matrixf& transform = Matrixf::Identity(3.f), float radius = 0.f);
+			static float ComputePolyMoment(float mass, const std::vector<Vector2f>& positions, const Affine2f& transform = Affine2f::Identity(), float radius = 0.f);
 			static float ComputeSegmentMoment(float mass, const Vector2f& from, const Vector2f& to, float radius);
 
 		private:
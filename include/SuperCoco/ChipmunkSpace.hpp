@@ -1,7 +1,7 @@
 #pragma once
 
 #include <SuperCoco/Export.hpp>
-#include <SuperCoco/Matrix.hpp>
+#include <SuperCoco/Affine2.hpp>
 #include <SuperCoco/Vector2.hpp>
 
 struct cpSpace;
@@ -18,7 +18,7 @@ namespace Sce
 			ChipmunkSpace(ChipmunkSpace&& space) noexcept;
 			~ChipmunkSpace();
 
-			void DebugDraw(Renderer& renderer, const Matrixf& cameraInverseTransform);
+			void DebugDraw(Renderer& renderer, const Affine2f& cameraInverseTransform);
 
 			cpSpace* GetHandle() const;
 
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <SuperCoco/Export.hpp>
-#include <SuperCoco/Matrix.hpp>
+#include <SuperCoco/Affine2.hpp>
 #include <SuperCoco/Vector2.hpp>
 #include <vector>
 
@@ -46,7 +46,7 @@ namespace Sce
 	struct SUPER_COCO_API ConvexShape : CollisionShape //< pour une struct, l'héritage est public par défaut
 	{
 		explicit ConvexShape(std::vector<Vector2f> pos, float radius = 0.f);
-		ConvexShape(const Model& model, Matrixf transformation = Matrixf::Identity(3.f), float radius = 0.f);
+		ConvexShape(const Model& model, const Affine2f& transformation = Affine2f::Identity(), float radius = 0.f);
 
 		ChipmunkShape Build(ChipmunkBody& body, const Vector2f& offset = Vector2f(0.f, 0.f)) const override;
 		float ComputeMoment(float mass, const Vector2f& offset = Vector2f(0.f, 0.f)) const override;
@@ -4,10 +4,13 @@
 #include <entt/entt.hpp>
 #include <nlohmann/json.hpp>
 #include <functional>
+#include <span>
 #include <string>
 
 namespace Sce
 {
+	class BinaryReader;
+	class BinaryWriter;
 	class WorldEditor;
 
 	// Pour permettre l'ajout de composants utilisateurs et avoir une liste des différents
@@ -16,6 +19,9 @@ namespace Sce
 	class SUPER_COCO_API ComponentRegistry
 	{
 		public:
+			// Ajoute à un registre les composants décodés par decodeColumn, pour les entités données (dans l'ordre de la colonne)
+			using ColumnInserter = std::function<void(entt::registry&, std::span<const entt::entity>)>;
+
 			struct Entry
 			{
 				std::string id;
@@ -26,6 +32,16 @@ namespace Sce
 				std::function<void(WorldEditor&, entt::handle)> inspect;
 				std::function<nlohmann::json(entt::handle)> serialize;
 				std::function<void(entt::handle, const nlohmann::json&)> unserialize;
+
+				// Sérialisation binaire par colonne (optionnelle, les scènes binaires utilisent serialize/unserialize sinon) :
+				// toutes les instances du composant sont écrites à la suite, decodeColumn ne doit pas toucher au registre
+				// afin de pouvoir être appelé depuis un thread de chargement
+				std::function<void(const entt::registry&, std::span<const entt::entity>, BinaryWriter&)> serializeColumn;
+				std::function<ColumnInserter(BinaryReader&, std::size_t)> decodeColumn;
+
+				// Instanciation de prefab (optionnelle, les prefabs passent par serialize/unserialize sinon) :
+				// copie le composant du prototype sur toutes les entités données, en un seul ajout
+				std::function<void(const entt::registry&, entt::entity, entt::registry&, std::span<const entt::entity>)> instantiate;
 			};
 
 			ComponentRegistry();
@@ -33,6 +49,7 @@ namespace Sce
 			ComponentRegistry(ComponentRegistry&&) = delete;
 			~ComponentRegistry() = default;
 
+			const Entry* FindComponent(const std::string& id) const;
 			void ForEachComponent(const std::function<void(const Entry&)>& callback) const;
 
 			void Register(Entry&& data);
@@ -41,10 +58,13 @@ namespace Sce
 			ComponentRegistry& operator=(ComponentRegistry&&) = delete;
 
 			template<typename T> static std::function<void(entt::handle)> BuildAddComponent();
+			template<typename T> static std::function<ColumnInserter(BinaryReader&, std::size_t)> BuildDecodeColumn();
 			template<typename T> static std::function<bool(entt::handle)> BuildHasComponent();
 			template<typename T> static std::function<void(entt::handle)> BuildRemoveComponent();
 			template<typename T> static std::function<void(WorldEditor&, entt::handle)> BuildInspect();
+			template<typename T> static std::function<void(const entt::registry&, entt::entity, entt::registry&, std::span<const entt::entity>)> BuildInstantiate();
 			template<typename T> static std::function<nlohmann::json(entt::handle)> BuildSerialize();
+			template<typename T> static std::function<void(const entt::registry&, std::span<const entt::entity>, BinaryWriter&)> BuildSerializeColumn();
 			template<typename T> static std::function<void(entt::handle, const nlohmann::json&)> BuildUnserialize();
 
 		private:
@@ -1,5 +1,6 @@
 #include <imgui.h>
 #include <type_traits>
+#include <vector>
 
 namespace Sce
 {
@@ -12,6 +13,34 @@ namespace Sce
 		};
 	}
 
+	template<typename T>
+	std::function<ComponentRegistry::ColumnInserter(BinaryReader&, std::size_t)> ComponentRegistry::BuildDecodeColumn()
+	{
+		// T doit fournir "static T UnserializeBinary(BinaryReader&)" (sauf s'il est vide)
+		return [](BinaryReader& reader, std::size_t count) -> ColumnInserter
+		{
+			if constexpr (std::is_empty_v<T>)
+			{
+				return [](entt::registry& registry, std::span<const entt::entity> entities)
+				{
+					registry.insert<T>(entities.begin(), entities.end());
+				};
+			}
+			else
+			{
+				std::vector<T> components;
+				components.reserve(count);
+				for (std::size_t i = 0; i < count; ++i)
+					components.push_back(T::UnserializeBinary(reader));
+
+				return [components = std::move(components)](entt::registry& registry, std::span<const entt::entity> entities)
+				{
+					registry.insert<T>(entities.begin(), entities.end(), components.begin());
+				};
+			}
+		};
+	}
+
 	template<typename T>
 	std::function<bool(entt::handle)> ComponentRegistry::BuildHasComponent()
 	{
@@ -39,6 +68,19 @@ namespace Sce
 		};
 	}
 
+	template<typename T>
+	std::function<void(const entt::registry&, entt::entity, entt::registry&, std::span<const entt::entity>)> ComponentRegistry::BuildInstantiate()
+	{
+		// T doit être copiable : chaque instance reçoit une copie du composant du prototype
+		return [](const entt::registry& prefabRegistry, entt::entity prototype, entt::registry& registry, std::span<const entt::entity> entities)
+		{
+			if constexpr (std::is_empty_v<T>)
+				registry.insert<T>(entities.begin(), entities.end());
+			else
+				registry.insert<T>(entities.begin(), entities.end(), prefabRegistry.get<T>(prototype));
+		};
+	}
+
 	template<typename T>
 	std::function<nlohmann::json(entt::handle)> ComponentRegistry::BuildSerialize()
 	{
@@ -51,6 +93,20 @@ namespace Sce
 		};
 	}
 
+	template<typename T>
+	std::function<void(const entt::registry&, std::span<const entt::entity>, BinaryWriter&)> ComponentRegistry::BuildSerializeColumn()
+	{
+		// T doit fournir "void SerializeBinary(BinaryWriter&) const" (sauf s'il est vide)
+		return [](const entt::registry& registry, std::span<const entt::entity> entities, BinaryWriter& writer)
+		{
+			if constexpr (!std::is_empty_v<T>)
+			{
+				for (entt::entity entity : entities)
+					registry.get<T>(entity).SerializeBinary(writer);
+			}
+		};
+	}
+
 	template<typename T>
 	std::function<void(entt::handle, const nlohmann::json&)> ComponentRegistry::BuildUnserialize()
 	{
@@ -7,6 +7,7 @@
 #include <nlohmann/json_fwd.hpp>
 #include <entt/fwd.hpp>
 #include <memory>
+#include <span>
 #include <string>
 
 namespace Sce
@@ -22,6 +23,7 @@ namespace Sce
 		void PopulateInspector(WorldEditor& worldEditor);
 		nlohmann::json Serialize(const entt::handle entity) const;
 
+		static void Instantiate(const entt::registry& prefabRegistry, entt::entity prototype, entt::registry& registry, std::span<const entt::entity> entities);
 		static void Unserialize(entt::handle entity, const nlohmann::json& doc);
 	};
 }
@@ -0,0 +1,24 @@
+#ifndef SUPERCOCO_HIERARCHYCOMPONENT_HPP
+#define SUPERCOCO_HIERARCHYCOMPONENT_HPP
+
+#pragma once
+
+#include <entt/entt.hpp>
+#include <cstdint>
+
+namespace Sce
+{
+	// Liens de hiérarchie d'une entité possédant un Transform, ajouté et tenu à jour par le HierarchySystem.
+	// Les enfants forment une liste doublement chaînée (premier enfant, puis frères) : aucun tableau alloué par noeud
+	// et un détachement en temps constant. La profondeur (0 pour une racine) sert à trier les Transform parents avant enfants.
+	struct HierarchyComponent
+	{
+		entt::entity parent = entt::null;
+		entt::entity firstChild = entt::null;
+		entt::entity previousSibling = entt::null;
+		entt::entity nextSibling = entt::null;
+		std::uint32_t depth = 0;
+	};
+}
+
+#endif
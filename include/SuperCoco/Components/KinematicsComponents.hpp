@@ -0,0 +1,20 @@
+#ifndef SUPERCOCO_KINEMATICSCOMPONENTS_HPP
+#define SUPERCOCO_KINEMATICSCOMPONENTS_HPP
+
+#pragma once
+
+namespace Sce
+{
+	// Stockage cinématique optionnel en structure de tableaux : chaque axe est un composant (donc un pool EnTT) distinct.
+	// Le KinematicsSystem les regroupe dans un groupe possédant, ce qui aligne les six pools : les N entités du groupe
+	// occupent les N premières places de chaque pool, dans le même ordre, et chaque page de pool est un tableau de floats.
+	// Une entité utilisant ce stockage ne doit pas avoir de VelocityComponent (elle serait intégrée deux fois).
+	struct KinematicPositionX { float value = 0.f; };
+	struct KinematicPositionY { float value = 0.f; };
+	struct KinematicVelocityX { float value = 0.f; };
+	struct KinematicVelocityY { float value = 0.f; };
+	struct KinematicAccelerationX { float value = 0.f; };
+	struct KinematicAccelerationY { float value = 0.f; };
+}
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef SUPERCOCO_PENDINGMODELCOMPONENT_HPP
+#define SUPERCOCO_PENDINGMODELCOMPONENT_HPP
+
+#pragma once
+
+#include <SuperCoco/AssetHandle.hpp>
+#include <string>
+
+namespace Sce
+{
+	class Model;
+
+	// Modèle en cours de chargement pour le GraphicsComponent de l'entité (qui affiche le modèle "manquant" en attendant),
+	// l'AssetLoadingSystem le met en place puis retire ce composant une fois le chargement terminé
+	struct PendingModelComponent
+	{
+		AssetHandle<Model> model;
+		std::string modelPath; //< resérialisé tel quel si la scène est sauvegardée avant la fin du chargement
+	};
+}
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef SUPERCOCO_POOLCOMPONENTS_HPP
+#define SUPERCOCO_POOLCOMPONENTS_HPP
+
+#pragma once
+
+#include <SuperCoco/Components/GraphicsComponent.hpp>
+#include <cstdint>
+#include <optional>
+
+namespace Sce
+{
+	class EntityPool;
+
+	// Marque une entité rangée dans un EntityPool : les systèmes l'excluent de leurs vues.
+	// Le GraphicsComponent est retiré (ce qui la sort du rendu et du découpage spatial) et conservé ici pour être remis tel quel
+	struct InactiveComponent
+	{
+		std::optional<GraphicsComponent> graphics;
+	};
+
+	// Pool auquel rendre l'entité à sa mort plutôt que de la détruire.
+	// Une entité recyclée garde son identifiant : la génération, incrémentée à chaque Release, distingue ses vies successives
+	struct PooledComponent
+	{
+		EntityPool* pool;
+		std::uint32_t generation = 0;
+	};
+}
+
+#endif
@@ -47,10 +47,14 @@ namespace Sce
 			cpShape* GetShape(size_t index) const;
 			cpBody* GetBody() const;
 
+			bool IsEnabled() const;
+
 			void RemoveShape(const std::shared_ptr<CollisionShape>& shape, bool recomputeMoment = true);
 
 			void SetAngularVelocity(float angularVelocity);
 			void SetCenterOfGravity(const Vector2f& centerOfGravity);
+			// Un corps désactivé sort de l'espace physique avec ses shapes (plus de collisions ni de simulation) sans être détruit
+			void SetEnabled(bool enabled);
 			void SetLinearVelocity(const Vector2f& linearVelocity);
 			void SetMass(float mass, bool recomputeMoment = true);
 			void SetTag(Tag type);
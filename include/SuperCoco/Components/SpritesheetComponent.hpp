@@ -6,6 +6,7 @@
 #include <entt/fwd.hpp>
 #include <nlohmann/json_fwd.hpp>
 #include <memory>
+#include <span>
 
 namespace Sce
 {
@@ -25,6 +26,7 @@ namespace Sce
 		void PopulateInspector(WorldEditor& worldEditor);
 
 		nlohmann::json Serialize(entt::handle entity) const;
+		static void Instantiate(const entt::registry& prefabRegistry, entt::entity prototype, entt::registry& registry, std::span<const entt::entity> entities);
 		static void Unserialize(entt::handle entity, const nlohmann::json& doc);
 
 		void Update(float deltaTime);
@@ -3,6 +3,7 @@
 #include <SuperCoco/Font.hpp>
 #include <SuperCoco/Texture.hpp>
 #include <SuperCoco/Renderable.hpp>
+#include <SuperCoco/TextMesh.hpp>
 #include <SuperCoco/Vector2.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/handle.hpp>
@@ -30,9 +31,10 @@ namespace Sce
 
 		void PopulateInspector(WorldEditor& worldEditor) override;
 
-		void Render(Renderer& renderer, const Matrixf& transformMatrix) const override;
+		void Render(Renderer& renderer, const Affine2f& transformMatrix) const override;
 		SDL_FRect GetBounds() const override;
 		int GetLayer() const override;
+		const Texture* GetTexture() const override;
 
 		nlohmann::json Serialize() const override;
 		nlohmann::json Serialize(entt::handle entity) const;
@@ -40,7 +42,9 @@ namespace Sce
 		static void Unserialize(entt::handle entity, const nlohmann::json& doc);
 
 	private:
-		std::unique_ptr<Texture> m_texture;
+		void UpdateMesh();
+
+		TextMesh m_mesh;
 		std::shared_ptr<Font> m_font;
 		SDL_Color m_color;
 		std::string m_text;
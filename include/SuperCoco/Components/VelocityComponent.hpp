@@ -8,6 +8,8 @@
 
 namespace Sce
 {
+	class BinaryReader;
+	class BinaryWriter;
 	class WorldEditor;
 
 	struct SUPER_COCO_API VelocityComponent
@@ -19,7 +21,9 @@ namespace Sce
 
 		void PopulateInspector(WorldEditor& worldEditor);
 		nlohmann::json Serialize(const entt::handle entity) const;
+		void SerializeBinary(BinaryWriter& writer) const;
 		static void Unserialize(entt::handle entity, const nlohmann::json& doc);
+		static VelocityComponent UnserializeBinary(BinaryReader& reader);
 	};
 
 
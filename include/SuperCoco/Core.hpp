@@ -17,6 +17,7 @@ namespace Sce
 {
 	class Sprite;
 	class Renderer;
+	class SpatialSystem;
 	class Transform;
 
 	template<typename T> struct Vector2;
@@ -43,7 +44,7 @@ namespace Sce
 		entt::handle CreateText(entt::registry& registry, std::string text, const Sce::Vector2f& position);
 
 		Transform GetCameraTransform(entt::registry& registry);
-		entt::handle GetHoveredEntity(entt::registry& registry, entt::handle camera);
+		entt::handle GetHoveredEntity(entt::registry& registry, entt::handle camera, const SpatialSystem& spatialSystem);
 
 		static Vector2i GetMousePosition();
 
@@ -0,0 +1,109 @@
+#ifndef SUPERCOCO_ENTITYCOMMANDBUFFER_HPP
+#define SUPERCOCO_ENTITYCOMMANDBUFFER_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <entt/entt.hpp>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Sce
+{
+	// Enregistre les modifications structurelles du registre (création/destruction d'entités, ajout/retrait de composants)
+	// pour les appliquer plus tard d'un seul bloc avec Playback(), à un point de synchronisation où personne ne parcourt le registre.
+	// Permet de modifier le registre depuis un parcours de vue, un callback de collision (pendant cpSpaceStep) ou un système parallèle :
+	// chaque thread enregistre dans ses propres tableaux, sans verrou après le premier appel.
+	//
+	// Au Playback, les commandes sont regroupées par type et appliquées par plages (create/insert/remove/destroy d'EnTT) dans cet ordre :
+	// créations, ajouts de composants, fonctions différées, retraits de composants puis destructions.
+	// Un ajout sur une entité possédant déjà le composant le remplace, les commandes visant une entité détruite entre-temps sont ignorées.
+	// L'ordre d'enregistrement n'est conservé qu'entre les commandes d'un même thread.
+	// Playback ne doit pas être appelé pendant que d'autres threads enregistrent.
+	class SUPER_COCO_API EntityCommandBuffer
+	{
+		public:
+			// Entité dont la création est différée, seules les commandes de ce buffer peuvent la désigner
+			struct DeferredEntity
+			{
+				std::uint32_t index;
+			};
+
+			explicit EntityCommandBuffer(entt::registry& registry);
+			EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+			EntityCommandBuffer(EntityCommandBuffer&&) = delete;
+			~EntityCommandBuffer();
+
+			DeferredEntity Create();
+
+			// Fonction exécutée au Playback avec un accès direct au registre (construction d'entités complexes, comme Core::CreateText)
+			void Defer(std::function<void(entt::registry& registry)> func);
+
+			void Destroy(entt::entity entity);
+			template<typename It> void Destroy(It first, It last);
+
+			template<typename T, typename... Args> void Emplace(entt::entity entity, Args&&... args);
+			template<typename T, typename... Args> void Emplace(DeferredEntity entity, Args&&... args);
+
+			template<typename T> void Remove(entt::entity entity);
+
+			void Playback();
+
+			EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+			EntityCommandBuffer& operator=(EntityCommandBuffer&&) = delete;
+
+		private:
+			// Entité existante (deferredIndex == NotDeferred) ou créée au Playback
+			struct Target
+			{
+				static constexpr std::uint32_t NotDeferred = ~std::uint32_t(0);
+
+				entt::entity entity;
+				std::uint32_t deferredIndex;
+
+				entt::entity Resolve(const std::vector<entt::entity>& createdEntities) const;
+			};
+
+			class ComponentCommands
+			{
+				public:
+					virtual ~ComponentCommands() = default;
+
+					virtual void Append(ComponentCommands& commands) = 0;
+					virtual void PlaybackEmplace(entt::registry& registry, const std::vector<entt::entity>& createdEntities) = 0;
+					virtual void PlaybackRemove(entt::registry& registry, const std::vector<entt::entity>& createdEntities) = 0;
+			};
+
+			template<typename T> class TypedComponentCommands;
+
+			struct Commands
+			{
+				std::thread::id owner;
+				std::unordered_map<entt::id_type, std::unique_ptr<ComponentCommands>> components;
+				std::vector<entt::entity> destroyedEntities;
+				std::vector<std::function<void(entt::registry& registry)>> deferredFunctions;
+			};
+
+			template<typename T, typename... Args> void EmplaceTarget(const Target& target, Args&&... args);
+			template<typename T> TypedComponentCommands<T>& GetComponentCommands();
+			Commands& GetLocalCommands();
+
+			static void MergeCommands(Commands& destination, Commands& source);
+
+			std::atomic_uint32_t m_createdCount;
+			std::mutex m_mutex;
+			std::uint64_t m_bufferId;
+			std::vector<std::unique_ptr<Commands>> m_threadCommands;
+			entt::registry& m_registry;
+	};
+}
+
+#include <SuperCoco/EntityCommandBuffer.inl>
+
+#endif
@@ -0,0 +1,142 @@
+#include <iterator>
+#include <type_traits>
+
+namespace Sce
+{
+	template<typename T>
+	class EntityCommandBuffer::TypedComponentCommands : public ComponentCommands
+	{
+		public:
+			void Append(ComponentCommands& commands) override
+			{
+				auto& typedCommands = static_cast<TypedComponentCommands&>(commands);
+
+				m_emplaced.insert(m_emplaced.end(), typedCommands.m_emplaced.begin(), typedCommands.m_emplaced.end());
+				m_values.insert(m_values.end(), std::make_move_iterator(typedCommands.m_values.begin()), std::make_move_iterator(typedCommands.m_values.end()));
+				m_removed.insert(m_removed.end(), typedCommands.m_removed.begin(), typedCommands.m_removed.end());
+			}
+
+			void PlaybackEmplace(entt::registry& registry, const std::vector<entt::entity>& createdEntities) override
+			{
+				// insert() refuse les entités possédant déjà le composant et les doublons : celles-ci sont remplacées,
+				// et pour une entité visée plusieurs fois seule la dernière valeur est gardée
+				std::vector<entt::entity> insertedEntities;
+				std::vector<T> insertedValues;
+				std::unordered_map<entt::entity, std::size_t> insertedIndices;
+
+				for (std::size_t i = 0; i < m_emplaced.size(); ++i)
+				{
+					entt::entity entity = m_emplaced[i].Resolve(createdEntities);
+					if (!registry.valid(entity))
+						continue;
+
+					if constexpr (std::is_empty_v<T>)
+					{
+						if (!registry.all_of<T>(entity) && insertedIndices.emplace(entity, insertedEntities.size()).second)
+							insertedEntities.push_back(entity);
+					}
+					else
+					{
+						if (registry.all_of<T>(entity))
+						{
+							registry.replace<T>(entity, std::move(m_values[i]));
+							continue;
+						}
+
+						auto [it, inserted] = insertedIndices.emplace(entity, insertedEntities.size());
+						if (inserted)
+						{
+							insertedEntities.push_back(entity);
+							insertedValues.push_back(std::move(m_values[i]));
+						}
+						else
+							insertedValues[it->second] = std::move(m_values[i]);
+					}
+				}
+
+				if constexpr (std::is_empty_v<T>)
+					registry.insert<T>(insertedEntities.begin(), insertedEntities.end());
+				else
+					registry.insert<T>(insertedEntities.begin(), insertedEntities.end(), std::make_move_iterator(insertedValues.begin()));
+			}
+
+			void PlaybackRemove(entt::registry& registry, const std::vector<entt::entity>& createdEntities) override
+			{
+				std::vector<entt::entity> removedEntities;
+				removedEntities.reserve(m_removed.size());
+				for (const Target& target : m_removed)
+				{
+					entt::entity entity = target.Resolve(createdEntities);
+					if (registry.valid(entity))
+						removedEntities.push_back(entity);
+				}
+
+				registry.remove<T>(removedEntities.begin(), removedEntities.end());
+			}
+
+			template<typename... Args>
+			void RecordEmplace(const Target& target, Args&&... args)
+			{
+				m_emplaced.push_back(target);
+				if constexpr (!std::is_empty_v<T>)
+				{
+					// Même règle qu'EnTT : les agrégats sont construits par initialisation entre accolades
+					if constexpr (std::is_aggregate_v<T>)
+						m_values.push_back(T{ std::forward<Args>(args)... });
+					else
+						m_values.emplace_back(std::forward<Args>(args)...);
+				}
+			}
+
+			void RecordRemove(const Target& target)
+			{
+				m_removed.push_back(target);
+			}
+
+		private:
+			std::vector<Target> m_emplaced;
+			std::vector<Target> m_removed;
+			std::vector<T> m_values; //< vide pour les composants sans donnée (tags)
+	};
+
+	template<typename It>
+	void EntityCommandBuffer::Destroy(It first, It last)
+	{
+		Commands& commands = GetLocalCommands();
+		commands.destroyedEntities.insert(commands.destroyedEntities.end(), first, last);
+	}
+
+	template<typename T, typename... Args>
+	void EntityCommandBuffer::Emplace(entt::entity entity, Args&&... args)
+	{
+		EmplaceTarget<T>(Target{ entity, Target::NotDeferred }, std::forward<Args>(args)...);
+	}
+
+	template<typename T, typename... Args>
+	void EntityCommandBuffer::Emplace(DeferredEntity entity, Args&&... args)
+	{
+		EmplaceTarget<T>(Target{ entt::null, entity.index }, std::forward<Args>(args)...);
+	}
+
+	template<typename T>
+	void EntityCommandBuffer::Remove(entt::entity entity)
+	{
+		GetComponentCommands<T>().RecordRemove(Target{ entity, Target::NotDeferred });
+	}
+
+	template<typename T, typename... Args>
+	void EntityCommandBuffer::EmplaceTarget(const Target& target, Args&&... args)
+	{
+		GetComponentCommands<T>().RecordEmplace(target, std::forward<Args>(args)...);
+	}
+
+	template<typename T>
+	EntityCommandBuffer::TypedComponentCommands<T>& EntityCommandBuffer::GetComponentCommands()
+	{
+		std::unique_ptr<ComponentCommands>& componentCommands = GetLocalCommands().components[entt::type_hash<T>::value()];
+		if (!componentCommands)
+			componentCommands = std::make_unique<TypedComponentCommands<T>>();
+
+		return static_cast<TypedComponentCommands<T>&>(*componentCommands);
+	}
+}
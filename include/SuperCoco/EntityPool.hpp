@@ -0,0 +1,85 @@
+#ifndef SUPERCOCO_ENTITYPOOL_HPP
+#define SUPERCOCO_ENTITYPOOL_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <entt/entt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Sce
+{
+	// Recycle les entités à forte rotation (ennemis, textes de dégâts, projectiles) : au lieu d'être détruite,
+	// une entité rendue au pool est désactivée (InactiveComponent) et garde ses composants, donc son corps physique,
+	// ses shapes et son renderable (et la texture qui va avec). Acquire la réactive avant d'en créer de nouvelles.
+	//
+	// Désactiver une entité retire son GraphicsComponent (rendu et découpage spatial) et sort son RigidBodyComponent de l'espace physique :
+	// Acquire et Release modifient donc la structure du registre et ne doivent pas être appelés pendant un parcours de vue ni pendant cpSpaceStep
+	// (passer par l'EntityCommandBuffer dans ce cas).
+	class SUPER_COCO_API EntityPool
+	{
+		public:
+			// Crée entities.size() nouvelles entités avec leurs composants et les écrit dans entities (comme Prefab::Instantiate)
+			using CreateCallback = std::function<void(entt::registry& registry, std::span<entt::entity> entities)>;
+			// Appelé sur une entité réactivée pour remettre son état de départ (vie, échelle, vitesse...)
+			using ResetCallback = std::function<void(entt::handle entity)>;
+
+			struct Stats
+			{
+				std::size_t acquireCount = 0; //< entités demandées
+				std::size_t hitCount = 0;     //< entités demandées servies par une entité recyclée
+				std::size_t releaseCount = 0; //< entités rendues au pool
+				std::size_t pooledCount = 0;  //< entités actuellement inactives dans le pool
+
+				float GetHitRate() const;
+			};
+
+			EntityPool(entt::registry& registry, CreateCallback create, ResetCallback reset = nullptr, std::size_t maxPooledCount = std::numeric_limits<std::size_t>::max());
+			EntityPool(const EntityPool&) = delete;
+			EntityPool(EntityPool&&) = delete;
+			~EntityPool();
+
+			entt::handle Acquire();
+			// Remplit entities : d'abord les entités recyclées (réinitialisées par le ResetCallback), puis celles créées par lot
+			void Acquire(std::span<entt::entity> entities);
+
+			// Détruit les entités inactives, les entités actives restent dans le registre
+			void Clear();
+
+			const Stats& GetStats() const;
+
+			// Désactive l'entité et la garde pour un prochain Acquire (ou la détruit si le pool est plein)
+			void Release(entt::entity entity);
+
+			// Crée count entités d'avance et les range dans le pool, pour éviter les créations au premier pic d'apparitions
+			void Reserve(std::size_t count);
+			void ResetStats();
+
+			EntityPool& operator=(const EntityPool&) = delete;
+			EntityPool& operator=(EntityPool&&) = delete;
+
+			// Génération courante de l'entité (0 hors pool), à capturer avec elle par ce qui peut lui survivre (timers, callbacks)
+			static std::uint32_t GetGeneration(const entt::registry& registry, entt::entity entity);
+			// Vrai si l'entité est valide, active et n'a pas été recyclée depuis la lecture de generation
+			static bool IsAlive(const entt::registry& registry, entt::entity entity, std::uint32_t generation);
+
+		private:
+			void Activate(entt::entity entity);
+			void Create(std::span<entt::entity> entities);
+			void Deactivate(entt::entity entity);
+
+			CreateCallback m_create;
+			ResetCallback m_reset;
+			entt::registry& m_registry;
+			std::size_t m_maxPooledCount;
+			std::vector<entt::entity> m_inactiveEntities;
+			Stats m_stats;
+	};
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef SUPERCOCO_FILEWATCHER_HPP
+#define SUPERCOCO_FILEWATCHER_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Sce
+{
+	// Surveille une liste de fichiers et signale ceux qui ont été modifiés.
+	// Sous Linux les notifications viennent d'inotify (un watch par dossier), ailleurs les dates de modification
+	// sont comparées à intervalle régulier. Poll() ne bloque jamais et doit être appelé depuis un seul thread.
+	class SUPER_COCO_API FileWatcher
+	{
+	public:
+		explicit FileWatcher(float pollInterval = 0.5f);
+		FileWatcher(const FileWatcher&) = delete;
+		FileWatcher(FileWatcher&&) = delete;
+		~FileWatcher();
+
+		bool IsUsingNativeNotifications() const;
+
+		// Renvoie les chemins (tels que passés à Watch) modifiés depuis le dernier appel, sans doublons
+		std::vector<std::string> Poll();
+
+		void Unwatch(const std::string& filepath);
+		void Watch(const std::string& filepath);
+
+		FileWatcher& operator=(const FileWatcher&) = delete;
+		FileWatcher& operator=(FileWatcher&&) = delete;
+
+	private:
+		struct WatchedFile
+		{
+			std::filesystem::path normalizedPath;
+			std::filesystem::file_time_type lastWriteTime;
+		};
+
+		void PollModificationTimes(std::unordered_set<std::string>& changedFiles);
+		void PollNativeNotifications(std::unordered_set<std::string>& changedFiles);
+
+		std::chrono::steady_clock::duration m_pollInterval;
+		std::chrono::steady_clock::time_point m_nextPoll;
+		std::unordered_map<std::string /*filepath*/, WatchedFile> m_files;
+		std::unordered_map<std::string /*normalizedPath*/, std::vector<std::string /*filepath*/>> m_filesByNormalizedPath;
+		std::unordered_map<int /*watchDescriptor*/, std::filesystem::path> m_directoriesByWatch;
+		std::unordered_map<std::string /*directory*/, int /*watchDescriptor*/> m_watchesByDirectory;
+		int m_inotifyFd;
+	};
+}
+
+#endif
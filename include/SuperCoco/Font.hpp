@@ -1,7 +1,11 @@
 #pragma once
 #include <SuperCoco/Export.hpp>
+#include <SuperCoco/SkylinePacker.hpp>
+#include <cstdint>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 #include <SDL2/SDL_ttf.h>
 
 namespace Sce
@@ -12,6 +16,14 @@ namespace Sce
 	class SUPER_COCO_API Font
 	{
 	public:
+		// Glyphe rasterisé une seule fois (en blanc) dans une page de l'atlas de la police, la couleur est appliquée par les vertices
+		struct Glyph
+		{
+			SDL_Rect rect;
+			std::size_t pageIndex;
+			int advance;
+		};
+
 		Font() = delete;
 		Font(const Font&) = delete;
 		Font(Font&& font) noexcept;
@@ -23,13 +35,30 @@ namespace Sce
 		int GetSize() const;
 		const std::string& GetAssetName() const;
 
+		const Glyph& GetGlyph(std::uint32_t codepoint);
+		const std::shared_ptr<Texture>& GetGlyphPage(std::size_t pageIndex) const;
+		int GetKerning(std::uint32_t previousCodepoint, std::uint32_t codepoint) const;
+		int GetLineHeight() const;
+		int GetLineSkip() const;
+		std::size_t GetMemorySize() const;
+
 		Texture GenerateText(std::string text, SDL_Color color) const;
 
 		static Font OpenFont(Renderer& renderer, const std::string& path, int size);
+		// SDL_ttf lit la police à la demande : data doit rester valide tant que la police existe
+		static Font OpenFontFromMemory(Renderer& renderer, const std::string& assetName, const void* data, std::size_t dataSize, int size);
 
 	private:
 		explicit Font(Renderer* renderer, TTF_Font* font, int size, const std::string& assetName);
 
+		struct GlyphPage
+		{
+			std::shared_ptr<Texture> texture;
+			SkylinePacker packer;
+		};
+
+		std::unordered_map<std::uint32_t, Glyph> m_glyphs;
+		std::vector<GlyphPage> m_glyphPages;
 		TTF_Font* m_font;
 		int m_size;
 
@@ -37,4 +66,3 @@ namespace Sce
 		std::string m_assetName;
 	};
 }
-
@@ -0,0 +1,38 @@
+#ifndef SUPERCOCO_KINEMATICSINTEGRATION_HPP
+#define SUPERCOCO_KINEMATICSINTEGRATION_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <SuperCoco/VertexTransform.hpp>
+#include <cstddef>
+
+namespace Sce
+{
+	// Colonnes (structure de tableaux) de count entités, chaque pointeur désigne count floats
+	struct KinematicsColumns
+	{
+		float* positionX;
+		float* positionY;
+		float* velocityX;
+		float* velocityY;
+		const float* accelerationX;
+		const float* accelerationY;
+	};
+
+	struct KinematicsSettings
+	{
+		float deltaTime;
+		float gravity;      //< ajoutée à l'accélération verticale
+		float groundHeight; //< une entité passant sous le sol y est ramenée et perd sa vitesse verticale
+	};
+
+	// Gravité, vitesse et sol en une seule passe : v += (a + g) * dt, p += v * dt, puis p.y = min(p.y, sol)
+	// L'implémentation la plus rapide supportée par le processeur est choisie au premier appel.
+	SUPER_COCO_API void IntegrateKinematics(const KinematicsColumns& columns, std::size_t count, const KinematicsSettings& settings);
+
+	// Permet de forcer une implémentation (benchmark, débogage), un niveau non supporté se rabat sur le meilleur niveau disponible
+	SUPER_COCO_API void IntegrateKinematics(SimdLevel level, const KinematicsColumns& columns, std::size_t count, const KinematicsSettings& settings);
+}
+
+#endif
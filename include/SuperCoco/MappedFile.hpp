@@ -0,0 +1,45 @@
+#ifndef SUPERCOCO_MAPPEDFILE_HPP
+#define SUPERCOCO_MAPPEDFILE_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace Sce
+{
+	// Fichier projeté en lecture seule dans l'espace d'adressage du processus : le système charge les pages à la demande
+	// et les partage entre processus, aucune copie n'est faite côté moteur
+	class SUPER_COCO_API MappedFile
+	{
+	public:
+		MappedFile(const MappedFile&) = delete;
+		MappedFile(MappedFile&& mappedFile) noexcept;
+		~MappedFile();
+
+		std::span<const std::uint8_t> GetData() const;
+		std::size_t GetSize() const;
+
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile& operator=(MappedFile&& mappedFile) noexcept;
+
+		static MappedFile Open(const std::string& filepath);
+
+	private:
+		MappedFile();
+
+		void Close();
+
+		const std::uint8_t* m_data;
+		std::size_t m_size;
+#ifdef _WIN32
+		void* m_fileHandle;
+		void* m_mappingHandle;
+#endif
+	};
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <SuperCoco/Affine2.hpp>
 #include <SuperCoco/Asset.hpp>
 #include <SuperCoco/Color.hpp>
 #include <SuperCoco/Export.hpp>
@@ -10,16 +11,16 @@
 #include <SuperCoco/Vector2.hpp>
 #include <nlohmann/json_fwd.hpp>
 #include <SDL2/SDL.h>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <memory>
+#include <span>
 #include <vector>
 #include <filesystem>
 
 namespace Sce
 {
-	template<typename T> class Matrix;
-	using Matrixf = Matrix<float>;
-
 	class Renderer;
 	class Texture;
 	class WorldEditor;
@@ -34,19 +35,32 @@ namespace Sce
 	class SUPER_COCO_API Model : public Asset, public IRenderable
 	{
 		public:
+			// Permet de choisir comment la texture référencée par un fichier est obtenue (par défaut via le ResourceManager)
+			using TextureResolver = std::function<std::shared_ptr<Texture>(const std::string& texturePath)>;
+
 			Model();
 			Model(std::shared_ptr<Texture> sharedTexture, std::vector<ModelVertex> vertices, std::vector<int> indices, std::string filepath);
+			Model(std::shared_ptr<Texture> sharedTexture, std::vector<SDL_Vertex> vertices, std::vector<int> indices, std::string filepath);
 			Model(const Model&) = delete;
 			Model(Model&&) = default;
 			~Model() = default;
 
+			Model& operator=(const Model&) = delete;
+			Model& operator=(Model&&) = default;
+
 
-			virtual void Render(Renderer& renderer, const Matrixf& transformMatrix) const override;
+			// Le modèle est partagé entre ses instances et n'est jamais modifié par le rendu : les vertices transformés sont écrits
+			// dans le cache de l'instance, et ne sont recalculés que si sa matrice a changé depuis la frame précédente
+			void Render(Renderer& renderer, const Affine2f& transformMatrix) const override;
+			void RenderInstance(Renderer& renderer, const Affine2f& transformMatrix, RenderCache& cache) const override;
 
 			nlohmann::json SaveToJSon() const;
 
 			SDL_FRect GetBounds() const override;
 			int GetLayer() const override;
+			const Texture* GetTexture() const override;
+			const std::vector<int>& GetIndices() const;
+			std::size_t GetMemorySize() const;
 			const std::vector<ModelVertex>& GetVertices() const;
 
 			bool IsValid() const;
@@ -57,25 +71,39 @@ namespace Sce
 
 			bool SaveToFile(const std::string& filepath) const;
 
+			// Convertit un modèle (.model, .cmodel ou .bmodel v1) au format binaire v2, éventuellement compressé en LZ4
+			static bool ConvertToBinary(const std::string& sourcePath, const std::string& destinationPath, bool compress = true);
+
 			static Model LoadFromFile(const std::string& filepath);
+			static Model LoadFromFile(const std::string& filepath, const TextureResolver& textureResolver);
+			static Model LoadFromMemory(const std::string& filepath, const void* data, std::size_t size);
+			static Model LoadFromMemory(const std::string& filepath, const void* data, std::size_t size, const TextureResolver& textureResolver);
 			static Model LoadFromJson(const nlohmann::json& doc, std::string filepath = {});
+			static Model LoadFromJson(const nlohmann::json& doc, const TextureResolver& textureResolver, std::string filepath = {});
+			// Chargement synchrone, GraphicsComponent::Unserialize passe par ResourceManager::LoadModelAsync pour les modèles référencés par leur chemin
 			static std::shared_ptr<Model> Unserialize(const nlohmann::json& doc);
 
 		private:
 			bool SaveToFileRegular(const std::string& filepath) const;
 			bool SaveToFileCompressed(const std::string& filepath) const;
 			bool SaveToFileBinary(const std::string& filepath) const;
+			bool SaveToFileBinary(const std::string& filepath, const std::string& texturePath, bool compress) const;
+
+			static Model LoadFromMemoryRegular(std::span<const std::uint8_t> content, const std::string& filepath, const TextureResolver& textureResolver);
+			static Model LoadFromMemoryCompressed(std::span<const std::uint8_t> content, const std::string& filepath, const TextureResolver& textureResolver);
+			static Model LoadFromMemoryBinary(std::span<const std::uint8_t> buffer, const std::string& filepath, const TextureResolver& textureResolver);
+			static Model LoadFromMemoryBinaryV1(std::span<const std::uint8_t> buffer, const std::string& filepath, const TextureResolver& textureResolver);
 
-			static Model LoadFromFileRegular(const std::string& filepath);
-			static Model LoadFromFileCompressed(const std::string& filepath);
-			static Model LoadFromFileBinary(const std::string& filepath);
+			static std::shared_ptr<Texture> ResolveTextureFromResourceManager(const std::string& texturePath);
 
 			std::shared_ptr<Texture> m_texture;
 			std::vector<ModelVertex> m_vertices;
+			std::vector<Vector2f> m_positions; //< copie contiguë des positions, pour TransformPoints
 
-			mutable std::vector<SDL_Vertex> m_sdlVertices;
+			std::vector<SDL_Vertex> m_sdlVertices; //< vertices au format de la SDL en espace local (tex_coord et color prêts), copiés dans le cache de chaque instance
 			std::vector<int> m_indices;
 			SDL_FRect m_bounds;
+			std::uint64_t m_revision; //< unique par modèle construit : un modèle rechargé (réassigné) invalide les caches de ses instances
 	};
 }
 
@@ -7,6 +7,8 @@
 
 namespace Sce
 {
+	class BinaryReader;
+	class BinaryWriter;
 	class WorldEditor;
 
 	// Petit composant pour nommer une entité (pour l'inspecteur)
@@ -16,7 +18,9 @@ namespace Sce
 
 		void PopulateInspector(WorldEditor& worldEditor);
 		nlohmann::json Serialize(const entt::handle entity) const;
+		void SerializeBinary(BinaryWriter& writer) const;
 		static void Unserialize(entt::handle entity, const nlohmann::json& doc);
+		static NameComponent UnserializeBinary(BinaryReader& reader);
 
 		std::string name;
 	};
@@ -0,0 +1,20 @@
+#ifndef SUPERCOCO_PARALLELFOREACH_HPP
+#define SUPERCOCO_PARALLELFOREACH_HPP
+
+#pragma once
+
+#include <SuperCoco/ThreadPool.hpp>
+#include <entt/entt.hpp>
+
+namespace Sce
+{
+	// Équivalent parallèle de view.each() : func(entity, composants...) est appelée pour chaque entité de la vue,
+	// par paquets répartis sur le ThreadPool. func ne doit modifier que les composants de l'entité reçue
+	// et ne doit pas modifier la structure du registre (création/destruction d'entités, ajout/retrait de composants).
+	template<typename View, typename F>
+	void ParallelForEach(ThreadPool& threadPool, const View& view, F&& func, std::size_t grainSize = DefaultGrainSize, ParallelChunking chunking = ParallelChunking::Deterministic);
+}
+
+#include <SuperCoco/ParallelForEach.inl>
+
+#endif
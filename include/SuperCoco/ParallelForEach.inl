@@ -0,0 +1,21 @@
+#include <tuple>
+#include <vector>
+
+namespace Sce
+{
+	template<typename View, typename F>
+	void ParallelForEach(ThreadPool& threadPool, const View& view, F&& func, std::size_t grainSize, ParallelChunking chunking)
+	{
+		// Les itérateurs des vues à plusieurs composants ne permettent pas l'accès direct : on fige d'abord la liste des entités
+		std::vector<entt::entity> entities(view.begin(), view.end());
+
+		threadPool.ParallelFor(entities.size(), [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				entt::entity entity = entities[i];
+				std::apply([&](auto&... components) { func(entity, components...); }, view.get(entity));
+			}
+		}, grainSize, chunking);
+	}
+}
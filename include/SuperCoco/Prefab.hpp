@@ -0,0 +1,53 @@
+#ifndef SUPERCOCO_PREFAB_HPP
+#define SUPERCOCO_PREFAB_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <SuperCoco/Asset.hpp>
+#include <entt/entt.hpp>
+#include <nlohmann/json_fwd.hpp>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace Sce
+{
+	class ComponentRegistry;
+
+	// Modèle d'entité : un prototype (dans un registre privé) dont les composants sont décodés une seule fois
+	// puis copiés sur chaque instance. Les composants sont ajoutés type par type à toutes les instances d'un lot,
+	// les données immuables (textures, spritesheets, modèles) restent partagées.
+	// Un composant sans ComponentRegistry::Entry::instantiate est resérialisé une fois par lot puis désérialisé sur chaque instance.
+	//
+	// Format : { "Version": 1, "Components": { "<id de composant>": {...} } }, en JSON (.prefab) ou en CBOR (.bprefab)
+	class SUPER_COCO_API Prefab : public Asset
+	{
+		public:
+			explicit Prefab(const ComponentRegistry& componentRegistry, std::string filepath = {});
+			Prefab(const Prefab&) = delete;
+			Prefab(Prefab&& prefab) noexcept;
+			~Prefab();
+
+			const ComponentRegistry& GetComponentRegistry() const;
+			// Entité prototype, ses composants peuvent aussi être ajoutés directement (prefab construit par le code)
+			entt::handle GetPrototype();
+
+			entt::handle Instantiate(entt::registry& registry) const;
+			void Instantiate(entt::registry& registry, std::span<entt::entity> entities) const; //< crée entities.size() instances
+
+			Prefab& operator=(const Prefab&) = delete;
+			Prefab& operator=(Prefab&& prefab) noexcept;
+
+			static Prefab LoadFromFile(const std::string& filepath, const ComponentRegistry& componentRegistry);
+			static Prefab LoadFromJson(const std::string& filepath, const nlohmann::json& doc, const ComponentRegistry& componentRegistry);
+			static Prefab LoadFromMemory(const std::string& filepath, const void* data, std::size_t size, const ComponentRegistry& componentRegistry);
+
+		private:
+			std::unique_ptr<entt::registry> m_prototypeRegistry; //< sur le tas : le prototype ne bouge pas quand le Prefab est déplacé
+			entt::entity m_prototype;
+			const ComponentRegistry* m_componentRegistry;
+	};
+}
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef SUPERCOCO_RENDERCACHE_HPP
+#define SUPERCOCO_RENDERCACHE_HPP
+
+#pragma once
+
+#include <SuperCoco/Affine2.hpp>
+#include <SDL2/SDL_render.h>
+#include <cstdint>
+#include <vector>
+
+namespace Sce
+{
+	// Données de rendu propres à une instance d'un renderable partagé (un même Model affiché par plusieurs entités) :
+	// le RenderSystem en garde une par entité et le renderable y conserve ce qu'il a calculé d'une frame à l'autre
+	struct RenderCache
+	{
+		std::vector<SDL_Vertex> vertices; //< vertices transformés par matrix
+		Affine2f matrix;
+		std::uint64_t revision = 0; //< version du renderable ayant rempli le cache (0 : vide)
+	};
+}
+
+#endif
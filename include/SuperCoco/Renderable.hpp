@@ -11,20 +11,26 @@ struct SDL_FRect;
 namespace Sce
 {
 	class Renderer;
+	class Texture;
+	struct RenderCache;
 	class WorldEditor;
 
-	template<typename T> class Matrix;
-	using Matrixf = Matrix<float>;
+	template<typename T> struct Affine2;
+	using Affine2f = Affine2<float>;
 
 	class SUPER_COCO_API IRenderable
 	{
 	public:
 		virtual ~IRenderable() = default;
 
-		virtual void Render(Renderer& renderer, const Matrixf& transformMatrix) const = 0;
+		virtual void Render(Renderer& renderer, const Affine2f& transformMatrix) const = 0;
+		// Rendu d'une instance par le RenderSystem, cache étant propre à l'entité dessinée : un renderable partagé entre
+		// plusieurs entités peut y garder son travail d'une frame à l'autre. Par défaut, appelle simplement Render
+		virtual void RenderInstance(Renderer& renderer, const Affine2f& transformMatrix, RenderCache& cache) const;
 
 		virtual SDL_FRect GetBounds() const = 0;
 		virtual int GetLayer() const = 0;
+		virtual const Texture* GetTexture() const = 0;
 
 		virtual void PopulateInspector(WorldEditor& worldEditor) = 0;
 		virtual nlohmann::json Serialize() const = 0;
@@ -2,11 +2,15 @@
 #define SUPERCOCO_RENDERER_H
 
 #include <SuperCoco/Export.hpp>
+#include <SuperCoco/Vector2.hpp>
+#include <SDL2/SDL_render.h>
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 
 struct SDL_Renderer;
 struct SDL_Rect;
+struct SDL_Texture;
 struct SDL_Vertex;
 struct SDL_FPoint;
 
@@ -20,6 +24,14 @@ namespace Sce
 		friend class Texture;
 
 	public:
+		struct FrameStats
+		{
+			std::size_t drawCalls = 0;
+			std::size_t submittedGeometries = 0;
+			std::size_t vertexCount = 0;
+			std::size_t indexCount = 0;
+		};
+
 		Renderer(Window& window, int renderer = -1, std::uint32_t flags = 0);
 		Renderer(const Renderer& renderer) = delete;
 		~Renderer();
@@ -28,6 +40,15 @@ namespace Sce
 
 		inline SDL_Renderer* GetHandle() { return m_renderer; };
 
+		// Entre BeginBatch et EndBatch, les RenderGeometry successifs utilisant la même texture
+		// sont fusionnés et envoyés en un seul SDL_RenderGeometry
+		void BeginBatch();
+		void EndBatch();
+		void FlushBatch();
+
+		const FrameStats& GetFrameStats() const;
+		bool IsBatching() const;
+
 		void RenderClear();
 		void RenderPresent();
 		void RenderDrawColor(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a);
@@ -47,7 +68,16 @@ namespace Sce
 	private:
 		SDL_Renderer* GetHandle() const { return m_renderer; };
 
+		void DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices, const int* indices, int numIndices);
+		void SubmitGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices, const int* indices, int numIndices);
+
+		std::vector<SDL_Vertex> m_batchVertices;
+		std::vector<int> m_batchIndices;
+		FrameStats m_currentStats;
+		FrameStats m_lastFrameStats;
 		SDL_Renderer* m_renderer;
+		SDL_Texture* m_batchTexture;
+		bool m_isBatching;
 	};
 }
 
@@ -2,25 +2,51 @@
 #define SUPERCOCO_RESOURCEMANAGER_HPP
 
 #include <SuperCoco/Export.hpp>
+#include <SuperCoco/AssetHandle.hpp>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <filesystem>
 
 namespace Sce
 {
+	class AssetArchive;
+	class ComponentRegistry;
 	class Texture;
 	class Renderer;
 	class Surface;
 	class Spritesheet;
 	class Model;
+	class Prefab;
+	class FileWatcher;
 	class Font;
+	class TextureAtlas;
+	class ThreadPool;
 
 	class SUPER_COCO_API ResourceManager
 	{
 		
 		public:
-			ResourceManager(Renderer* renderer);
+			// Mémoire occupée par les ressources en cache, par catégorie (en octets)
+			struct MemoryStats
+			{
+				std::size_t fontBytes = 0; //< pages d'atlas de glyphes
+				std::size_t modelBytes = 0; //< vertices et indices
+				std::size_t spritesheetBytes = 0;
+				std::size_t textureBytes = 0; //< textures isolées et pages de l'atlas rempli au chargement
+				std::size_t pinnedBytes = 0; //< pages de l'atlas pré-construit, jamais libérées et donc hors budget
+
+				std::size_t GetEvictableTotal() const;
+				std::size_t GetTotal() const;
+			};
+
+			ResourceManager(Renderer* renderer, std::size_t loaderThreadCount = 2);
 			ResourceManager(const ResourceManager&) = delete;
 			ResourceManager(const ResourceManager&&) = delete;
 			~ResourceManager();
@@ -29,7 +55,46 @@ namespace Sce
 			const std::shared_ptr<Texture>& GetTexture(const std::string& filepath);
 			const std::shared_ptr<Spritesheet>& GetSpritesheet(const std::string& spritesheetPath);
 			const std::shared_ptr<Font>& GetFont(const std::string& fontPath, uint8_t size);
+			// Les composants du prefab sont décodés avec les désérialiseurs du ComponentRegistry donné lors du premier chargement
+			const std::shared_ptr<Prefab>& GetPrefab(const std::string& prefabPath, const ComponentRegistry& componentRegistry);
+
+			// Variantes asynchrones : le décodage (fichier, PNG, JSON, LZ4) se fait sur un thread de chargement,
+			// seule la création des textures SDL a lieu sur le thread principal, dans Update() et dans la limite du budget par frame.
+			// Les polices restent synchrones : FreeType partage son état entre toutes les polices ouvertes.
+			AssetHandle<Model> LoadModelAsync(const std::string& modelPath);
+			AssetHandle<Spritesheet> LoadSpritesheetAsync(const std::string& spritesheetPath);
+			AssetHandle<Texture> LoadTextureAsync(const std::string& filepath);
+
+			std::size_t GetMemoryBudget() const;
+			MemoryStats GetMemoryStats() const;
+			std::size_t GetPendingLoadCount() const;
+			std::size_t GetUploadBudget() const;
+
+			// Au-delà de ce budget (0 : illimité), les ressources qui ne sont plus référencées hors du cache
+			// sont libérées à chaque Update(), les moins récemment utilisées en premier.
+			// Les octets épinglés (MemoryStats::pinnedBytes) et les prefabs ne comptent pas dans ce budget
+			void SetMemoryBudget(std::size_t bytes);
+			void SetUploadBudget(std::size_t bytesPerFrame);
+
+			// Finalise les chargements asynchrones terminés et applique le budget mémoire,
+			// à appeler une fois par frame depuis le thread de rendu
+			void Update();
+
+			// Surveille les fichiers des ressources en cache : un fichier modifié est rechargé en arrière-plan puis son contenu
+			// remplace celui de l'objet existant, les shared_ptr déjà distribués voient donc directement la nouvelle version
+			void EnableHotReload(bool enable = true);
+			bool IsHotReloadEnabled() const;
+
+			// Projette en mémoire une archive construite par SceAssetPacker (AssetArchive::BuildToFile) : les ressources qu'elle contient
+			// y sont lues en priorité, sans passer par le système de fichiers. Ces ressources ne sont pas rechargées à chaud.
+			// Plusieurs archives peuvent être montées, la dernière montée est prioritaire. Les précédentes restent projetées
+			// jusqu'à la destruction du ResourceManager (des polices peuvent lire directement dans leur projection).
+			bool MountArchive(const std::string& archivePath);
 
+			// Charge un atlas construit hors-ligne (TextureAtlas::BuildToFile), ses régions sont ensuite renvoyées par GetTexture
+			bool LoadTextureAtlas(const std::string& manifestPath);
+
+			// Libère toutes les ressources qui ne sont plus référencées hors du cache (prefabs compris), quel que soit le budget
 			void Purge();
 
 			static ResourceManager& Instance();
@@ -38,13 +103,82 @@ namespace Sce
 			ResourceManager& operator=(const ResourceManager&&) = delete;
 
 		private:
+			// Chargement décodé sur un thread de travail, en attente de finalisation sur le thread principal
+			struct CompletedLoad
+			{
+				std::function<void()> finalize;
+				std::size_t uploadSize; //< octets envoyés au GPU lors de la finalisation
+			};
+
+			template<typename T>
+			struct CacheEntry
+			{
+				std::shared_ptr<T> asset;
+				std::uint64_t lastUsedFrame; //< dernière frame où la ressource a été demandée ou référencée
+			};
+
+			template<typename T> using Cache = std::unordered_map<std::string, CacheEntry<T>>;
+
+			// Modèle lu sur un thread de chargement, sa texture n'est créée qu'à la finalisation (FinalizeModel)
+			struct DecodedModel
+			{
+				std::shared_ptr<Model> model;
+				std::shared_ptr<Surface> textureSurface;
+				std::string texturePath;
+
+				std::size_t GetUploadSize() const;
+			};
+
+			std::shared_ptr<Texture> CreateTexture(const std::string& filepath, const Surface& surface);
+			DecodedModel DecodeModel(const std::string& modelPath) const;
+			void EvictUnused(std::size_t bytesToFree);
+			Model FinalizeModel(const std::string& modelPath, const DecodedModel& decodedModel);
+			template<typename T> std::shared_ptr<T>* FindCached(Cache<T>& cache, const std::string& key);
+			const std::shared_ptr<Model>& GetMissingModel();
+			const std::shared_ptr<Spritesheet>& GetMissingSpritesheet();
+			const std::shared_ptr<Texture>& GetMissingTexture();
+			// Dernière archive montée contenant ce fichier, ou nullptr (utilisable depuis les threads de chargement)
+			const AssetArchive* FindArchive(const std::string& filepath) const;
+			bool IsArchived(const std::string& filepath) const;
+			template<typename T> static bool IsReferenced(const std::shared_ptr<T>& asset);
+			// Lecture depuis l'archive montée si elle contient le fichier, depuis le disque sinon (utilisables depuis les threads de chargement)
+			Font OpenFont(const std::string& fontPath, int size) const;
+			Model LoadModel(const std::string& modelPath, const std::function<std::shared_ptr<Texture>(const std::string&)>& textureResolver) const;
+			Prefab LoadPrefab(const std::string& prefabPath, const ComponentRegistry& componentRegistry) const;
+			Spritesheet LoadSpritesheet(const std::string& spritesheetPath) const;
+			Surface LoadSurface(const std::string& filepath) const;
+			void PushCompletedLoad(std::function<void()> finalize, std::size_t uploadSize);
+			void RebuildModelsUsingTexture(const std::shared_ptr<Texture>& texture);
+			void ReloadFile(const std::string& filepath);
+			void ReloadFonts(const std::string& fontPath);
+			void ReloadModel(const std::string& modelPath);
+			void ReloadPrefab(const std::string& prefabPath);
+			void ReloadSpritesheet(const std::string& spritesheetPath);
+			void ReloadTexture(const std::string& filepath);
+			template<typename T> const std::shared_ptr<T>& StoreCached(Cache<T>& cache, const std::string& key, std::shared_ptr<T> asset);
+
 			std::shared_ptr<Spritesheet> m_missingSpritesheet;
 			std::shared_ptr<Texture> m_missingTexture;
 			std::shared_ptr<Model> m_missingModel;
-			std::unordered_map<std::string, std::shared_ptr<Font>> m_fonts;
-			std::unordered_map<std::string, std::shared_ptr<Model>> m_models;
-			std::unordered_map<std::string, std::shared_ptr<Texture>> m_textures;
-			std::unordered_map<std::string, std::shared_ptr<Spritesheet>> m_spritesheets;
+			std::vector<std::unique_ptr<AssetArchive>> m_archives; //< déclarées avant les caches : les polices lisent directement leur projection
+			mutable std::shared_mutex m_archiveMutex; //< protège m_archives, lu par les threads de chargement pendant un montage
+			Cache<Font> m_fonts;
+			Cache<Model> m_models;
+			Cache<Prefab> m_prefabs;
+			Cache<Texture> m_textures;
+			Cache<Spritesheet> m_spritesheets;
+			std::unique_ptr<TextureAtlas> m_textureAtlas;
+			std::unique_ptr<TextureAtlas> m_prebuiltAtlas;
+			std::unique_ptr<FileWatcher> m_fileWatcher;
+			std::unordered_map<std::string, std::shared_ptr<AssetHandle<Model>::State>> m_pendingModels;
+			std::unordered_map<std::string, std::shared_ptr<AssetHandle<Spritesheet>::State>> m_pendingSpritesheets;
+			std::unordered_map<std::string, std::shared_ptr<AssetHandle<Texture>::State>> m_pendingTextures;
+			std::deque<CompletedLoad> m_completedLoads;
+			mutable std::mutex m_completedLoadsMutex;
+			std::size_t m_memoryBudget;
+			std::size_t m_uploadBudget;
+			std::uint64_t m_currentFrame;
+			std::unique_ptr<ThreadPool> m_loaderPool; //< détruit en premier, ses tâches utilisent les membres ci-dessus
 
 			Renderer* m_renderer;
 
@@ -0,0 +1,37 @@
+#ifndef SUPERCOCO_SCENESERIALIZER_HPP
+#define SUPERCOCO_SCENESERIALIZER_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <entt/fwd.hpp>
+#include <cstddef>
+#include <string>
+
+namespace Sce
+{
+	class ComponentRegistry;
+
+	// Format binaire des scènes (.bscene), pensé pour charger de très grandes scènes (le JSON reste utilisé pour les diffs) :
+	//
+	// | en-tête | hiérarchie (paires d'indices parent/enfant) | colonnes |
+	//
+	// Les entités sont désignées par leur indice dans la scène. Chaque colonne regroupe les instances d'un composant :
+	// identifiant, encodage, indices des entités puis données, au format binaire du composant s'il en a un (serializeColumn),
+	// en CBOR (JSON binaire) sinon. Un composant très répandu est découpé en plusieurs colonnes d'au plus MaxColumnRows lignes.
+	// Au chargement les colonnes sont décodées en parallèle (une tâche par colonne) puis insérées d'un bloc dans le registre.
+	class SUPER_COCO_API SceneSerializer
+	{
+	public:
+		SceneSerializer() = delete;
+
+		// Ajoute les entités de la scène au registre. Avec replaceExisting, le registre n'est vidé qu'une fois le fichier
+		// entièrement lu et décodé : un fichier tronqué ou corrompu laisse la scène ouverte intacte
+		static bool LoadBinary(entt::registry& registry, const ComponentRegistry& componentRegistry, const std::string& filepath, bool replaceExisting = false);
+		static bool SaveBinary(entt::registry& registry, const ComponentRegistry& componentRegistry, const std::string& filepath);
+
+		static constexpr std::size_t MaxColumnRows = 16 * 1024;
+	};
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef SUPERCOCO_SKYLINEPACKER_HPP
+#define SUPERCOCO_SKYLINEPACKER_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <SDL2/SDL_rect.h>
+#include <optional>
+#include <vector>
+
+namespace Sce
+{
+	// Empaqueteur de rectangles "skyline" (bottom-left) : on garde uniquement la ligne d'horizon formée par le haut des
+	// rectangles déjà placés, et chaque nouveau rectangle est posé là où son bord supérieur sera le plus bas possible.
+	// Moins dense que MaxRects mais bien plus simple et rapide, ce qui convient à un empaquetage au chargement.
+	class SUPER_COCO_API SkylinePacker
+	{
+	public:
+		SkylinePacker(int width, int height);
+
+		float GetOccupancy() const;
+
+		std::optional<SDL_Rect> Insert(int width, int height);
+
+		void Reset();
+
+	private:
+		struct Segment
+		{
+			int x;
+			int y;
+			int width;
+		};
+
+		std::optional<int> Fit(std::size_t segmentIndex, int width, int height) const;
+
+		std::vector<Segment> m_skyline;
+		long long m_usedArea;
+		int m_height;
+		int m_width;
+	};
+}
+
+#endif
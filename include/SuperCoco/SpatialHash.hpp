@@ -0,0 +1,98 @@
+#ifndef SUPERCOCO_SPATIALHASH_HPP
+#define SUPERCOCO_SPATIALHASH_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <SDL2/SDL_rect.h>
+#include <entt/entt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Sce
+{
+	template<typename T> struct Affine2;
+	using Affine2f = Affine2<float>;
+
+	template<typename T> struct Vector2;
+	using Vector2f = Vector2<float>;
+
+	// Grille de hachage spatiale : chaque entité est rangée dans toutes les cellules que recoupe sa boîte englobante (en monde).
+	// Une requête ne visite que les cellules concernées, soit un coût indépendant du nombre total d'entités.
+	// Les entités trop grandes (couvrant beaucoup de cellules) sont gardées à part et testées à chaque requête.
+	class SUPER_COCO_API SpatialHash
+	{
+	public:
+		SpatialHash(float cellSize = 128.f);
+		SpatialHash(const SpatialHash&) = delete;
+		SpatialHash(SpatialHash&&) noexcept = default;
+		~SpatialHash() = default;
+
+		void Clear();
+
+		bool Contains(entt::entity entity) const;
+
+		const SDL_FRect& GetBounds(entt::entity entity) const;
+		float GetCellSize() const;
+		int GetLayer(entt::entity entity) const;
+		std::size_t GetSize() const;
+
+		// Insère l'entité ou met à jour sa position si elle est déjà présente
+		void Insert(entt::entity entity, const SDL_FRect& bounds, int layer);
+
+		// Les résultats sont ajoutés au vecteur fourni (qui n'est pas vidé) afin de pouvoir réutiliser sa mémoire
+		void QueryPoint(const Vector2f& point, std::vector<entt::entity>& results) const;
+		void QueryRadius(const Vector2f& center, float radius, std::vector<entt::entity>& results) const;
+		void QueryRect(const SDL_FRect& rect, std::vector<entt::entity>& results) const;
+
+		void Remove(entt::entity entity);
+
+		SpatialHash& operator=(const SpatialHash&) = delete;
+		SpatialHash& operator=(SpatialHash&&) noexcept = default;
+
+		// Boîte englobante alignée sur les axes d'un rectangle local une fois transformé (les rotations l'agrandissent)
+		static SDL_FRect ComputeWorldBounds(const Affine2f& matrix, const SDL_FRect& localBounds);
+
+	private:
+		struct CellRange
+		{
+			int minX;
+			int minY;
+			int maxX;
+			int maxY;
+
+			bool operator==(const CellRange& other) const = default;
+		};
+
+		struct Item
+		{
+			SDL_FRect bounds;
+			CellRange cells;
+			entt::entity entity;
+			int layer;
+			bool isLarge;
+			mutable std::uint32_t queryStamp;
+		};
+
+		CellRange ComputeCellRange(const SDL_FRect& bounds) const;
+		template<typename F> void ForEachCandidate(const SDL_FRect& area, F&& callback) const;
+		void LinkItem(std::uint32_t slot);
+		void UnlinkItem(std::uint32_t slot);
+
+		static long long GetCellCount(const CellRange& range);
+		static std::uint64_t GetCellKey(int x, int y);
+
+		std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> m_cells;
+		std::unordered_map<entt::entity, std::uint32_t> m_entityToSlot;
+		std::vector<Item> m_items;
+		std::vector<std::uint32_t> m_freeSlots;
+		std::vector<std::uint32_t> m_largeItems;
+		float m_cellSize;
+		float m_invCellSize;
+		mutable std::uint32_t m_queryStamp;
+	};
+}
+
+#endif
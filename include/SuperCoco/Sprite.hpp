@@ -12,8 +12,8 @@ namespace Sce
 {
 	class Texture;
 	class Renderer;
-	template<typename T> class Matrix;
-	using Matrixf = Matrix<float>;
+	template<typename T> struct Affine2;
+	using Affine2f = Affine2<float>;
 
 	class SUPER_COCO_API Sprite : public IRenderable
 	{
@@ -21,10 +21,11 @@ namespace Sce
 		Sprite(std::shared_ptr<Texture> sharedTexture);
 		Sprite(std::shared_ptr<Texture> sharedTexture, const SDL_Rect& rect, float origin = 0.5f, int layer = 0);
 
-		virtual void Render(Renderer& renderer, const Matrixf& transformMatrix) const override;
+		virtual void Render(Renderer& renderer, const Affine2f& transformMatrix) const override;
 
 		SDL_FRect GetBounds() const override;
 		int GetLayer() const override;
+		const Texture* GetTexture() const override;
 
 		void PopulateInspector(WorldEditor& worldEditor) override;
 
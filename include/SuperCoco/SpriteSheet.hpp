@@ -33,10 +33,12 @@ namespace Sce
 		void SaveToFile(const std::string& filepath) const;
 
 		static Spritesheet LoadFromFile(const std::string& filepath);
+		static Spritesheet LoadFromMemory(const void* data, std::size_t size);
 
 		const Animation& GetAnimation(std::size_t animIndex) const;
 		std::optional<std::size_t> GetAnimationByName(const std::string& animName) const;
 		std::size_t GetAnimationCount() const;
+		std::size_t GetMemorySize() const;
 
 	private:
 		std::unordered_map<std::string /*animName*/, std::size_t /*animIndex*/> m_animationByName;
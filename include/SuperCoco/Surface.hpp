@@ -20,6 +20,10 @@ namespace Sce
 		~Surface();
 
 
+		void Blit(const Surface& source, int x, int y);
+
+		Surface ConvertToRGBA32() const;
+
 		void FillRect(const SDL_Rect& rect, std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a);
 
 		Surface& operator=(const Surface&) = delete;
@@ -27,11 +31,18 @@ namespace Sce
 
 		SDL_Surface* GetHandle() { return m_surface; };
 
+		int GetHeight() const;
 		std::uint8_t* GetPixels();
 		const std::uint8_t* GetPixels() const;
+		int GetPitch() const;
+		int GetWidth() const;
+
+		bool SaveToPNG(const std::string& path) const;
 
 		static Surface Create(int width, int height);
 		static Surface LoadFromFile(const std::string& path);
+		static Surface LoadFromMemory(const void* data, std::size_t size);
+		static Surface CreateTTFGlyphSurface(TTF_Font* font, std::uint32_t codepoint, const SDL_Color& color);
 		static Surface CreateTTFSurface(TTF_Font* font, const std::string& text, const SDL_Color& color);
 
 	private:
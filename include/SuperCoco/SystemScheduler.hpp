@@ -0,0 +1,101 @@
+#ifndef SUPERCOCO_SYSTEMSCHEDULER_HPP
+#define SUPERCOCO_SYSTEMSCHEDULER_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <entt/entt.hpp>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Sce
+{
+	class ThreadPool;
+
+	// Exécute les systèmes d'une frame en parallèle lorsque c'est possible : chaque système déclare les composants qu'il lit
+	// et ceux qu'il écrit, deux systèmes en conflit (l'un écrit ce que l'autre lit ou écrit) s'exécutent dans leur ordre d'ajout.
+	// Les systèmes modifiant la structure du registre (création/destruction d'entités, ajout/retrait de composants) doivent
+	// être déclarés exclusifs : ils s'exécutent seuls, sur le thread principal.
+	class SUPER_COCO_API SystemScheduler
+	{
+		public:
+			class System;
+
+			SystemScheduler(entt::registry& registry, ThreadPool& threadPool);
+			SystemScheduler(const SystemScheduler&) = delete;
+			SystemScheduler(SystemScheduler&&) = delete;
+			~SystemScheduler();
+
+			System& AddSystem(std::string name, std::function<void(float deltaTime)> update);
+
+			// Exécute tous les systèmes une fois, le thread appelant prend part au travail et revient lorsque tous ont terminé
+			void Run(float deltaTime);
+
+			SystemScheduler& operator=(const SystemScheduler&) = delete;
+			SystemScheduler& operator=(SystemScheduler&&) = delete;
+
+		private:
+			void BuildGraph();
+			void Execute(std::size_t systemIndex);
+			void Schedule(std::size_t systemIndex);
+
+			std::condition_variable m_systemCompleted;
+			std::exception_ptr m_error;
+			std::mutex m_mutex;
+			std::vector<std::unique_ptr<System>> m_systems;
+			std::vector<std::size_t> m_mainThreadQueue;
+			entt::registry& m_registry;
+			ThreadPool& m_threadPool;
+			std::size_t m_completedCount;
+			float m_deltaTime;
+			bool m_isGraphDirty;
+	};
+
+	class SUPER_COCO_API SystemScheduler::System
+	{
+		friend SystemScheduler;
+
+		public:
+			System(std::string name, std::function<void(float deltaTime)> update);
+			System(const System&) = delete;
+			~System() = default;
+
+			// Le système modifie la structure du registre : il n'est exécuté en même temps qu'aucun autre, sur le thread principal
+			System& Exclusive();
+
+			const std::string& GetName() const;
+
+			template<typename... T> System& Reads();
+
+			// Le système utilise des API réservées au thread principal (SDL, rendu) mais peut s'exécuter en même temps que d'autres
+			System& RunOnMainThread();
+
+			template<typename... T> System& Writes();
+
+			System& operator=(const System&) = delete;
+
+		private:
+			bool ConflictsWith(const System& other) const;
+			template<typename T> void DeclareComponent(std::vector<entt::id_type>& components);
+
+			std::function<void(float deltaTime)> m_update;
+			std::string m_name;
+			std::vector<entt::id_type> m_readComponents;
+			std::vector<entt::id_type> m_writeComponents;
+			std::vector<std::function<void(entt::registry&)>> m_storageAssurers;
+			std::vector<std::size_t> m_dependents;
+			std::size_t m_dependencyCount;
+			std::size_t m_remainingDependencies;
+			bool m_isExclusive;
+			bool m_isMainThreadOnly;
+	};
+}
+
+#include <SuperCoco/SystemScheduler.inl>
+
+#endif
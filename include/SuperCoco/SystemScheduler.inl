@@ -0,0 +1,34 @@
+#include <algorithm>
+
+namespace Sce
+{
+	template<typename... T>
+	SystemScheduler::System& SystemScheduler::System::Reads()
+	{
+		(DeclareComponent<T>(m_readComponents), ...);
+		return *this;
+	}
+
+	template<typename... T>
+	SystemScheduler::System& SystemScheduler::System::Writes()
+	{
+		(DeclareComponent<T>(m_writeComponents), ...);
+		return *this;
+	}
+
+	template<typename T>
+	void SystemScheduler::System::DeclareComponent(std::vector<entt::id_type>& components)
+	{
+		entt::id_type componentId = entt::type_hash<T>::value();
+		if (std::find(components.begin(), components.end(), componentId) != components.end())
+			return;
+
+		components.push_back(componentId);
+
+		// Créer un pool modifie le registre : on s'assure qu'il existe avant que les systèmes ne s'exécutent en parallèle
+		m_storageAssurers.push_back([](entt::registry& registry)
+		{
+			registry.storage<T>();
+		});
+	}
+}
@@ -8,14 +8,17 @@
 
 namespace Sce
 {
+	class ThreadPool;
+
 	class SUPER_COCO_API AnimationSystem
 	{
 	public:
-		AnimationSystem(entt::registry* registry);
+		AnimationSystem(entt::registry* registry, ThreadPool* threadPool = nullptr); //< sans ThreadPool, les entités sont traitées sur le thread appelant
 
 		void Update(float deltaTime);
 	private:
 		entt::registry* m_registry;
+		ThreadPool* m_threadPool;
 	};
 }
 
@@ -0,0 +1,27 @@
+#ifndef SUPERCOCO_ASSETLOADINGSYSTEM_HPP
+#define SUPERCOCO_ASSETLOADINGSYSTEM_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace Sce
+{
+	// Remplace le renderable des entités possédant un PendingModelComponent dès que leur modèle est chargé.
+	// L'état des AssetHandle n'évoluant que dans ResourceManager::Update(), ce système doit tourner sur le thread principal.
+	class SUPER_COCO_API AssetLoadingSystem
+	{
+	public:
+		AssetLoadingSystem(entt::registry* registry);
+
+		void Update();
+
+	private:
+		std::vector<entt::entity> m_loadedEntities;
+		entt::registry* m_registry;
+	};
+}
+
+#endif
@@ -8,15 +8,18 @@
 
 namespace Sce
 {
+	class ThreadPool;
+
 	class SUPER_COCO_API GravitySystem
 	{
 	public:
-		GravitySystem(entt::registry* registry);
+		GravitySystem(entt::registry* registry, ThreadPool* threadPool = nullptr); //< sans ThreadPool, les entités sont traitées sur le thread appelant
 
 		void ApplyGravity(float deltaTime);
 
 	private:
 		entt::registry* m_registry;
+		ThreadPool* m_threadPool;
 	};
 }
 
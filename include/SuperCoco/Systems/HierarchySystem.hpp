@@ -0,0 +1,59 @@
+#ifndef SUPERCOCO_HIERARCHYSYSTEM_HPP
+#define SUPERCOCO_HIERARCHYSYSTEM_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <entt/entt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Sce
+{
+	class ThreadPool;
+
+	// Tient à jour les liens de hiérarchie des Transform (HierarchyComponent) via les signaux EnTT :
+	// un Transform ajouté reçoit un HierarchyComponent, un Transform retiré est détaché de son parent et ses enfants deviennent racines.
+	//
+	// Update garde les pools HierarchyComponent et Transform triés par profondeur puis calcule toutes les matrices monde
+	// en un seul parcours linéaire, niveau de profondeur par niveau : les parents étant traités avant leurs enfants,
+	// aucun calcul ne remonte la hiérarchie et les entités d'un même niveau sont indépendantes les unes des autres.
+	class SUPER_COCO_API HierarchySystem
+	{
+	public:
+		HierarchySystem(entt::registry* registry, ThreadPool* threadPool = nullptr); //< avec un ThreadPool, chaque niveau est réparti entre les threads
+		HierarchySystem(const HierarchySystem&) = delete;
+		~HierarchySystem();
+
+		// Entités dont la matrice monde a changé (déplacées, ou dont un ancêtre a été déplacé) lors du dernier Update
+		std::span<const entt::entity> GetMovedEntities() const;
+
+		void Update();
+
+		HierarchySystem& operator=(const HierarchySystem&) = delete;
+
+		// Renvoie false (sans rien modifier) si le parent est l'entité elle-même ou l'un de ses descendants
+		static bool SetParent(entt::registry& registry, entt::entity entity, entt::entity parent);
+
+	private:
+		void OnHierarchyDestroy(entt::registry& registry, entt::entity entity);
+		void OnHierarchyUpdate(entt::registry& registry, entt::entity entity);
+		void OnTransformConstruct(entt::registry& registry, entt::entity entity);
+		void OnTransformDestroy(entt::registry& registry, entt::entity entity);
+		void UpdateWorldMatrices(std::span<const entt::entity> entities, std::span<std::uint8_t> movedFlags);
+
+		static void UpdateDepth(entt::registry& registry, entt::entity entity, std::uint32_t depth);
+
+		std::vector<entt::entity> m_depthOrder;
+		std::vector<entt::entity> m_movedEntities;
+		std::vector<std::size_t> m_levelOffsets;
+		std::vector<std::uint8_t> m_movedFlags; //< un octet par entité de m_depthOrder, écrit sans verrou par les threads de calcul
+		entt::registry* m_registry;
+		ThreadPool* m_threadPool;
+		bool m_isSortRequired;
+	};
+}
+
+#endif
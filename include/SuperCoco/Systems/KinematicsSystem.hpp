@@ -0,0 +1,40 @@
+#ifndef SUPERCOCO_KINEMATICSSYSTEM_HPP
+#define SUPERCOCO_KINEMATICSSYSTEM_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <SuperCoco/Vector2.hpp>
+#include <SuperCoco/VertexTransform.hpp>
+#include <entt/entt.hpp>
+
+namespace Sce
+{
+	class ThreadPool;
+
+	// Équivalent de GravitySystem + VelocitySystem pour les entités utilisant les KinematicsComponents :
+	// gravité, vitesse et sol sont intégrés en une seule passe SIMD sur les colonnes, puis la position n'est recopiée
+	// dans le Transform que pour les entités affichées (possédant un GraphicsComponent)
+	class SUPER_COCO_API KinematicsSystem
+	{
+	public:
+		KinematicsSystem(entt::registry* registry, ThreadPool* threadPool = nullptr, float gravity = 1000.f, float groundHeight = 720.f - 128.f); //< sans ThreadPool, les entités sont traitées sur le thread appelant
+
+		void Update(float deltaTime);
+		void Update(SimdLevel level, float deltaTime); //< force une implémentation (benchmark)
+
+		static void AddKinematics(entt::registry& registry, entt::entity entity, const Vector2f& position, const Vector2f& velocity, const Vector2f& acceleration = Vector2f(0.f, 0.f));
+		static void RemoveKinematics(entt::registry& registry, entt::entity entity);
+
+	private:
+		void Integrate(SimdLevel level, float deltaTime);
+		void SyncTransforms();
+
+		entt::registry* m_registry;
+		ThreadPool* m_threadPool;
+		float m_gravity;
+		float m_groundHeight;
+	};
+}
+
+#endif
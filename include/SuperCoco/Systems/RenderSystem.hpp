@@ -4,24 +4,75 @@
 #pragma once
 
 #include <SuperCoco/Export.hpp>
+#include <SuperCoco/RenderCache.hpp>
 #include <entt/entt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace Sce
 {
-	class Transform;
+	class IRenderable;
 	class Renderer;
+	class Transform;
+	class Window;
 
+	// La liste de rendu est persistante : elle est tenue à jour via les signaux EnTT de GraphicsComponent
+	// et n'est retriée (tri par paquets sur le layer, puis par texture) que lorsqu'elle a changé.
+	// Un changement de layer interne au renderable (ex: Sprite::SetLayer) doit être signalé par
+	// registry.patch<GraphicsComponent>(entity) pour être pris en compte.
+	// Les entités dont la boîte englobante (en monde) ne recoupe pas le rectangle de la caméra ne sont pas soumises au Renderer.
 	class SUPER_COCO_API RenderSystem
 	{
 	public:
-		RenderSystem(entt::registry* registry, Renderer* renderer);
+		struct CullingStats
+		{
+			std::size_t visibleCount = 0;
+			std::size_t culledCount = 0;
+		};
+
+		RenderSystem(entt::registry* registry, Renderer* renderer, Window* window);
+		RenderSystem(const RenderSystem&) = delete;
+		~RenderSystem();
+
+		const CullingStats& GetCullingStats() const;
 
 		void Render(float);
 
+		RenderSystem& operator=(const RenderSystem&) = delete;
+
 	private:
+		struct DrawEntry
+		{
+			entt::entity entity;
+			const IRenderable* renderable;
+			std::uint64_t textureId; //< identifiant de la page d'atlas, 0 sans texture
+			int layer;
+			std::uint32_t order;
+			RenderCache cache; //< propre à l'entité, les renderables partagés (modèles) y gardent leurs vertices transformés
+		};
+
+		void OnGraphicsConstruct(entt::registry& registry, entt::entity entity);
+		void OnGraphicsDestroy(entt::registry& registry, entt::entity entity);
+		void OnGraphicsUpdate(entt::registry& registry, entt::entity entity);
+
+		void RefreshEntry(DrawEntry& entry, const IRenderable* renderable);
+		void SortDrawList();
+		void UpdateDrawList();
+
+		std::vector<DrawEntry> m_drawList;
+		std::vector<DrawEntry> m_sortBuffer;
+		std::vector<entt::entity> m_pendingAdditions;
+		std::vector<entt::entity> m_pendingRefreshes;
+		std::vector<entt::entity> m_pendingRemovals;
+		std::vector<std::size_t> m_layerOffsets;
+		CullingStats m_cullingStats;
 		entt::registry* m_registry;
 		Renderer* m_renderer;
+		Window* m_window;
+		std::uint32_t m_nextOrder;
+		bool m_isSortDirty;
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
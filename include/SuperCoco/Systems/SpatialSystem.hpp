@@ -0,0 +1,47 @@
+#ifndef SUPERCOCO_SPATIALSYSTEM_HPP
+#define SUPERCOCO_SPATIALSYSTEM_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <SuperCoco/SpatialHash.hpp>
+#include <entt/entt.hpp>
+#include <span>
+#include <vector>
+
+namespace Sce
+{
+	// Maintient un SpatialHash des boîtes englobantes (en monde) des entités possédant un GraphicsComponent et un Transform.
+	// Update ne parcourt que les entités signalées : celles dont la matrice monde a changé (HierarchySystem::GetMovedEntities)
+	// et celles dont le GraphicsComponent a été ajouté, retiré ou modifié. Comme pour le RenderSystem, un changement de bornes
+	// ou de layer interne au renderable (ex: Sprite::Resize) doit être signalé par registry.patch<GraphicsComponent>(entity).
+	class SUPER_COCO_API SpatialSystem
+	{
+	public:
+		SpatialSystem(entt::registry* registry, float cellSize = 128.f);
+		SpatialSystem(const SpatialSystem&) = delete;
+		~SpatialSystem();
+
+		const SpatialHash& GetSpatialHash() const;
+
+		// Renvoie l'entité du layer le plus haut dont le renderable contient le point (test précis dans l'espace local)
+		entt::entity PickEntity(const Vector2f& worldPosition) const;
+
+		void QueryPoint(const Vector2f& point, std::vector<entt::entity>& results) const;
+		void QueryRadius(const Vector2f& center, float radius, std::vector<entt::entity>& results) const;
+		void QueryRect(const SDL_FRect& rect, std::vector<entt::entity>& results) const;
+
+		void Update(std::span<const entt::entity> movedEntities);
+
+		SpatialSystem& operator=(const SpatialSystem&) = delete;
+
+	private:
+		void MarkDirty(entt::registry& registry, entt::entity entity);
+
+		SpatialHash m_spatialHash;
+		std::vector<entt::entity> m_dirtyEntities;
+		entt::registry* m_registry;
+	};
+}
+
+#endif
@@ -6,13 +6,14 @@
 
 namespace Sce
 {
-	class VelocityComponent;
+	class ThreadPool;
 	class Transform;
+	struct VelocityComponent;
 
 	class SUPER_COCO_API VelocitySystem
 	{
 	public:
-		VelocitySystem(entt::registry* registry);
+		VelocitySystem(entt::registry* registry, ThreadPool* threadPool = nullptr); //< sans ThreadPool, les entités sont traitées sur le thread appelant
 		~VelocitySystem();
 
 		void ApplyVelocity(float deltaTime);
@@ -21,6 +22,7 @@ namespace Sce
 
 	private:
 		entt::registry* m_registry;
+		ThreadPool* m_threadPool;
 
 		static VelocitySystem* s_instance;
 	};
@@ -5,6 +5,7 @@
 
 #include <SuperCoco/Export.hpp>
 #include <SuperCoco/Renderable.hpp>
+#include <SuperCoco/TextMesh.hpp>
 #include <SuperCoco/Vector2.hpp>
 #include <entt/fwd.hpp>
 #include <SDL2/SDL.h>
@@ -35,9 +36,10 @@ namespace Sce
 
 		void PopulateInspector(WorldEditor& worldEditor) override;
 
-		virtual void Render(Renderer& renderer, const Matrixf& transformMatrix) const override;
+		virtual void Render(Renderer& renderer, const Affine2f& transformMatrix) const override;
 		SDL_FRect GetBounds() const override;
 		int GetLayer() const override;
+		const Texture* GetTexture() const override;
 
 		nlohmann::json Serialize() const override;
 		nlohmann::json Serialize(entt::handle entity) const;
@@ -45,7 +47,9 @@ namespace Sce
 		static void Unserialize(entt::handle entity, const nlohmann::json& doc);
 
 	private:
-		std::unique_ptr<Texture> m_texture;
+		void UpdateMesh();
+
+		TextMesh m_mesh;
 		std::shared_ptr<Font> m_font;
 		SDL_Color m_color;
 		std::string m_text;
@@ -0,0 +1,66 @@
+#ifndef SUPERCOCO_TEXTMESH_HPP
+#define SUPERCOCO_TEXTMESH_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <SuperCoco/Vector2.hpp>
+#include <SDL2/SDL.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Sce
+{
+	class Font;
+	class Renderer;
+	class Texture;
+
+	template<typename T> struct Affine2;
+	using Affine2f = Affine2<float>;
+
+	// Géométrie d'un texte : un quad par glyphe, chaque quad pointant dans l'atlas de glyphes de la police.
+	// Changer le texte ne rasterise que les glyphes encore jamais vus, changer la couleur ne touche qu'aux vertices.
+	class SUPER_COCO_API TextMesh
+	{
+	public:
+		TextMesh() = default;
+		TextMesh(const TextMesh&) = delete;
+		TextMesh(TextMesh&&) noexcept = default;
+		~TextMesh() = default;
+
+		void Build(Font& font, const std::string& text, const SDL_Color& color, const Vector2f& origin);
+		void Clear();
+
+		SDL_FRect GetBounds() const;
+		const Texture* GetTexture() const;
+
+		bool IsEmpty() const;
+
+		void Render(Renderer& renderer, const Affine2f& transformMatrix) const;
+
+		void SetColor(const SDL_Color& color);
+
+		TextMesh& operator=(const TextMesh&) = delete;
+		TextMesh& operator=(TextMesh&&) noexcept = default;
+
+	private:
+		// Suite de glyphes consécutifs partageant la même page, envoyée en un seul RenderGeometry
+		struct Run
+		{
+			std::shared_ptr<Texture> page;
+			std::size_t firstVertex;
+			std::size_t vertexCount;
+			std::size_t firstIndex;
+			std::size_t indexCount;
+		};
+
+		std::vector<Run> m_runs;
+		std::vector<Vector2f> m_positions;
+		std::vector<int> m_indices;
+		mutable std::vector<SDL_Vertex> m_vertices;
+		SDL_FRect m_bounds = { 0.f, 0.f, 0.f, 0.f };
+	};
+}
+
+#endif
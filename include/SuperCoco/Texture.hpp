@@ -3,6 +3,8 @@
 
 #include <SuperCoco/Asset.hpp>
 #include <SDL2/SDL.h>
+#include <cstdint>
+#include <memory>
 #include <string>
 
 struct SDL_Texture;
@@ -12,6 +14,8 @@ namespace Sce
 	class Renderer;
 	class Surface;
 
+	// Une texture peut aussi être une région d'une page d'atlas (voir TextureAtlas) : elle partage alors le SDL_Texture de la page
+	// et GetRect() ne renvoie que la taille de la région. GetTexCoords() donne les coordonnées de texture dans la page.
 	class SUPER_COCO_API Texture : public Asset
 	{
 		friend class Renderer;
@@ -26,10 +30,21 @@ namespace Sce
 
 		inline SDL_Texture* GetTextureHandle() { return m_texture; };
 
+		const Texture* GetAtlasPage() const;
+		std::uint64_t GetId() const;
+		std::size_t GetMemorySize() const;
 		SDL_Rect GetRect() const;
+		const SDL_Rect& GetRegion() const;
+		SDL_FRect GetTexCoords(const SDL_Rect& rect) const;
 		std::string GetPath() const;
 
+		bool IsAtlasRegion() const;
+
+		void Update(const Surface& surface, const SDL_Rect& rect);
+
+		static Texture Create(const Renderer& renderer, int width, int height);
 		static Texture CreateFromSurface(const Renderer& renderer, const Surface& surface);
+		static Texture CreateRegion(std::shared_ptr<Texture> page, const SDL_Rect& region, std::string filepath);
 		static Texture LoadFromFile(const Renderer& renderer, const std::string& filepath);
 
 		std::string m_path;
@@ -39,9 +54,14 @@ namespace Sce
 
 		SDL_Texture* GetTextureHandle() const { return m_texture; };
 
+		std::shared_ptr<Texture> m_page;
 		SDL_Texture* m_texture;
+		SDL_Rect m_region;
+		std::uint64_t m_id; //< unique et croissant (contrairement à l'adresse) : sert de clé de tri stable d'une exécution à l'autre
+		int m_pageWidth;
+		int m_pageHeight;
 	};
 }
 
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,72 @@
+#ifndef SUPERCOCO_TEXTUREATLAS_HPP
+#define SUPERCOCO_TEXTUREATLAS_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <SuperCoco/SkylinePacker.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Sce
+{
+	class Renderer;
+	class Surface;
+	class Texture;
+
+	// Regroupe des textures dans de grandes pages partagées : toutes les régions d'une même page utilisent le même SDL_Texture,
+	// ce qui permet au Renderer de les dessiner en un seul appel.
+	// Les pages peuvent être remplies au chargement (Insert) ou construites hors-ligne (BuildToFile) puis rechargées (LoadFromManifest).
+	class SUPER_COCO_API TextureAtlas
+	{
+	public:
+		TextureAtlas(Renderer* renderer, int pageSize = 2048, int padding = 1);
+		TextureAtlas(const TextureAtlas&) = delete;
+		TextureAtlas(TextureAtlas&&) noexcept = default;
+		~TextureAtlas() = default;
+
+		std::shared_ptr<Texture> Find(const std::string& name) const;
+
+		std::size_t GetMemorySize() const;
+		std::size_t GetPageCount() const;
+		int GetPageSize() const;
+
+		// Renvoie nullptr si la surface est trop grande pour tenir dans une page
+		std::shared_ptr<Texture> Insert(const std::string& name, const Surface& surface);
+
+		// Remplace le contenu d'une région existante en conservant l'objet Texture (et donc les références vers lui) :
+		// mise à jour sur place si la taille n'a pas changé, nouvel emplacement sinon. Renvoie false si la région n'existe pas
+		// ou si la nouvelle image ne tient pas dans une page.
+		bool Reload(const std::string& name, const Surface& surface);
+
+		// Libère les pages remplies au chargement dont aucune région n'est plus référencée hors de l'atlas
+		// (les pages d'un manifeste sont conservées), renvoie le nombre d'octets libérés
+		std::size_t ReleaseUnusedPages();
+
+		TextureAtlas& operator=(const TextureAtlas&) = delete;
+		TextureAtlas& operator=(TextureAtlas&&) noexcept = default;
+
+		static bool BuildToFile(const std::vector<std::string>& texturePaths, const std::string& manifestPath, int pageSize = 2048, int padding = 1);
+		static TextureAtlas LoadFromManifest(Renderer* renderer, const std::string& manifestPath);
+
+	private:
+		std::shared_ptr<Texture> AllocateRegion(const std::string& name, const Surface& surface);
+
+		struct Page
+		{
+			std::shared_ptr<Texture> texture;
+			std::optional<SkylinePacker> packer; //< absent pour les pages chargées depuis un manifeste (déjà pleines)
+		};
+
+		std::unordered_map<std::string, std::shared_ptr<Texture>> m_regions;
+		std::vector<Page> m_pages;
+		Renderer* m_renderer;
+		int m_padding;
+		int m_pageSize;
+	};
+}
+
+#endif
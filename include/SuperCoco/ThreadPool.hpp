@@ -0,0 +1,60 @@
+#ifndef SUPERCOCO_THREADPOOL_HPP
+#define SUPERCOCO_THREADPOOL_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Sce
+{
+	enum class ParallelChunking
+	{
+		Adaptive,      //< paquets agrandis selon le nombre de threads (au moins grainSize éléments) : moins de synchronisation
+		Deterministic  //< paquets de grainSize éléments exactement : le découpage ne dépend pas de la machine
+	};
+
+	constexpr std::size_t DefaultGrainSize = 1024;
+
+	// Groupe de threads de travail consommant une file de tâches, les tâches encore en file
+	// sont exécutées avant la destruction afin que leurs résultats ne soient jamais perdus silencieusement
+	class SUPER_COCO_API ThreadPool
+	{
+	public:
+		explicit ThreadPool(std::size_t threadCount = 0); //< 0 : un thread par coeur, moins le thread principal
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool(ThreadPool&&) = delete;
+		~ThreadPool();
+
+		std::size_t GetThreadCount() const;
+
+		// Découpe [0, count) en paquets traités en parallèle (le thread appelant y compris), revient lorsque tous ont été traités
+		// les exceptions levées par func sont relancées sur le thread appelant
+		void ParallelFor(std::size_t count, const std::function<void(std::size_t begin, std::size_t end)>& func, std::size_t grainSize = DefaultGrainSize, ParallelChunking chunking = ParallelChunking::Deterministic);
+
+		// Exécute une tâche en file sur le thread appelant (permet d'aider les threads de travail au lieu de les attendre)
+		bool RunPendingTask();
+
+		void Submit(std::function<void()> task);
+
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		ThreadPool& operator=(ThreadPool&&) = delete;
+
+	private:
+		void WorkerMain();
+
+		std::condition_variable m_taskAvailable;
+		std::deque<std::function<void()>> m_tasks;
+		std::mutex m_mutex;
+		std::vector<std::thread> m_workers;
+		bool m_isStopping;
+	};
+}
+
+#endif
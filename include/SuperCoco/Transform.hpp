@@ -4,6 +4,7 @@
 #define SUPER_COCO_TRANSFORM_HPP
 
 #include <SuperCoco/Export.hpp>
+#include <SuperCoco/Affine2.hpp>
 #include <SuperCoco/Vector2.hpp>
 #include <entt/entt.hpp>
 #include <nlohmann/json_fwd.hpp>
@@ -12,13 +13,19 @@
 
 namespace Sce
 {
-	template<typename T> class Matrix;
-	using Matrixf = Matrix<float>;
-
+	class BinaryReader;
+	class BinaryWriter;
+	class HierarchySystem;
 	class WorldEditor;
 
+	// La hiérarchie appartient à l'entité (HierarchyComponent) et non au Transform, qui ne retient que son entité propriétaire :
+	// EnTT peut déplacer ou trier les Transform dans sa mémoire sans que les liens ne soient à corriger.
+	// Ces liens sont tenus à jour par le HierarchySystem, qui doit être actif sur le registre ; copier un Transform ne copie
+	// donc que sa transformation locale.
 	class SUPER_COCO_API Transform
 	{
+		friend HierarchySystem;
+
 		public:
 			Transform();
 			Transform(const Transform& transform);
@@ -29,8 +36,9 @@ namespace Sce
 			float GetGlobalRotation() const;
 			Vector2f GetGlobalScale() const;
 
-			const std::vector<Transform*>& GetChildren() const;
+			entt::entity GetEntity() const;
 			Transform* GetParent() const;
+			entt::entity GetParentEntity() const;
 			const Vector2f& GetPosition() const;
 			float GetRotation() const;
 			const Vector2f& GetScale() const;
@@ -42,6 +50,8 @@ namespace Sce
 			void Scale(const Vector2f& scale);
 
 			nlohmann::json Serialize(const entt::handle entity) const;
+			// Le parent n'est pas sérialisé ici : les scènes enregistrent la hiérarchie à part
+			void SerializeBinary(BinaryWriter& writer) const;
 
 			void SetParent(Transform* parent);
 			void SetPosition(const Vector2f& position);
@@ -50,12 +60,12 @@ namespace Sce
 
 			void Translate(const Vector2f& translation);
 
-			Matrixf LocalToWorldMatrix() const;
-			Matrixf GetTransformMatrix3x3() const;
-			Matrixf LocalToWorld(const Matrixf& other) const;
+			const Affine2f& LocalToWorldMatrix() const;
+			const Affine2f& GetTransformMatrix3x3() const;
+			Affine2f LocalToWorld(const Affine2f& other) const;
 			Vector2f LocalToWorldPoint(const Vector2f& point) const;
-			Matrixf WorldToLocal(const Matrixf& other) const;
-			Matrixf WorldToLocalMatrix() const;
+			Affine2f WorldToLocal(const Affine2f& other) const;
+			const Affine2f& WorldToLocalMatrix() const;
 			Vector2f WorldToLocalPoint(const Vector2f& point) const;
 
 			Transform& operator=(const Transform& transform);
@@ -64,16 +74,29 @@ namespace Sce
 			std::string ToString() const;
 
 			static void Unserialize(entt::handle entity, const nlohmann::json& doc);
+			static Transform UnserializeBinary(BinaryReader& reader);
 
 		private:
-			void AttachChild(Transform* child);
-			void DetachChild(Transform* child);
+			void InvalidateLocal();
+			void InvalidateWorld();
+			void Link(entt::registry& registry, entt::entity entity);
+			void Unlink();
 
-			std::vector<Transform*> m_children;
-			Transform* m_parent;
+			entt::entity m_entity;
+			entt::registry* m_registry;
 			Vector2f m_position;
 			Vector2f m_scale;
 			float m_rotation;
+
+			// Matrices mises en cache, recalculées à la demande lorsqu'elles sont marquées comme sales
+			// invariant : si un Transform a sa matrice monde sale, tous ses descendants l'ont aussi
+			mutable Affine2f m_localMatrix;
+			mutable Affine2f m_worldMatrix;
+			mutable Affine2f m_invWorldMatrix;
+			mutable bool m_isLocalDirty;
+			mutable bool m_isWorldDirty;
+			mutable bool m_isInvWorldDirty;
+			bool m_hasWorldChanged; //< matrice monde invalidée depuis le dernier HierarchySystem::Update, qui la remet à false
 	};
 }
 
@@ -0,0 +1,36 @@
+#ifndef SUPERCOCO_VERTEXTRANSFORM_HPP
+#define SUPERCOCO_VERTEXTRANSFORM_HPP
+
+#pragma once
+
+#include <SuperCoco/Export.hpp>
+#include <cstddef>
+
+struct SDL_Vertex;
+
+namespace Sce
+{
+	template<typename T> struct Affine2;
+	using Affine2f = Affine2<float>;
+
+	template<typename T> struct Vector2;
+	using Vector2f = Vector2<float>;
+
+	enum class SimdLevel
+	{
+		Scalar,
+		SSE2,
+		AVX2
+	};
+
+	// Transforme count points par la matrice et écrit le résultat dans le champ position des vertices
+	// (tex_coord et color ne sont pas touchés). L'implémentation la plus rapide supportée par le processeur est choisie au premier appel.
+	SUPER_COCO_API void TransformPoints(const Affine2f& matrix, const Vector2f* input, SDL_Vertex* output, std::size_t count);
+
+	// Permet de forcer une implémentation (benchmark, débogage), un niveau non supporté se rabat sur le meilleur niveau disponible
+	SUPER_COCO_API void TransformPoints(SimdLevel level, const Affine2f& matrix, const Vector2f* input, SDL_Vertex* output, std::size_t count);
+
+	SUPER_COCO_API SimdLevel GetSupportedSimdLevel();
+}
+
+#endif
@@ -7,13 +7,13 @@
 namespace Sce
 {
 	class ComponentRegistry;
-	class Transform;
+	class SpatialSystem;
 	class Window;
 
 	class SUPER_COCO_API WorldEditor
 	{
 		public:
-			WorldEditor(Window& window, entt::registry& registry, const ComponentRegistry& componentRegistry);
+			WorldEditor(Window& window, entt::registry& registry, const ComponentRegistry& componentRegistry, const SpatialSystem& spatialSystem);
 			WorldEditor(const WorldEditor&) = delete;
 			WorldEditor(WorldEditor&&) = delete;
 			~WorldEditor() = default;
@@ -34,13 +34,14 @@ namespace Sce
 			void DisplayEntityListNode(entt::entity entity);
 			bool EntityInspector(entt::entity entity);
 			entt::entity GetCameraEntity();
-			entt::entity GetEntity(Transform* transform);
 			void LoadScene();
+			void PickEntityUnderMouse();
 			void SaveScene();
 
 			std::vector<entt::entity> m_inspectedEntities;
 			entt::registry& m_registry;
 			const ComponentRegistry& m_componentRegistry;
+			const SpatialSystem& m_spatialSystem;
 			Window& m_window;
 			bool m_isPaused;
 			std::string m_scenePath;
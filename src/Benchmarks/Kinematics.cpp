@@ -0,0 +1,107 @@
+#include <SuperCoco/Stopwatch.hpp>
+#include <SuperCoco/ThreadPool.hpp>
+#include <SuperCoco/Transform.hpp>
+#include <SuperCoco/Components/KinematicsComponents.hpp>
+#include <SuperCoco/Components/VelocityComponent.hpp>
+#include <SuperCoco/Systems/GravitySystem.hpp>
+#include <SuperCoco/Systems/HierarchySystem.hpp>
+#include <SuperCoco/Systems/KinematicsSystem.hpp>
+#include <SuperCoco/Systems/VelocitySystem.hpp>
+#include <entt/entt.hpp>
+#include <fmt/core.h>
+#include <cstdlib>
+#include <utility>
+
+// Compare gravité + vitesse via GravitySystem/VelocitySystem (Transform + VelocityComponent, deux passes)
+// au KinematicsSystem (colonnes SoA, une seule passe) sur 100k entités non affichées, avec et sans ThreadPool ;
+// chaque mesure garde le meilleur temps sur plusieurs itérations
+constexpr std::size_t EntityCount = 100'000;
+constexpr int IterationCount = 20;
+constexpr float DeltaTime = 1.f / 60.f;
+
+template<typename F>
+float Measure(F&& func)
+{
+	float bestTime = 0.f;
+	for (int i = 0; i < IterationCount; ++i)
+	{
+		Sce::Stopwatch stopwatch;
+		func();
+		float elapsedTime = stopwatch.GetElapsedTime();
+
+		if (i == 0 || elapsedTime < bestTime)
+			bestTime = elapsedTime;
+	}
+
+	return bestTime;
+}
+
+int main()
+{
+	entt::registry registry;
+	Sce::HierarchySystem hierarchySystem(&registry);
+	Sce::KinematicsSystem kinematicsSystem(&registry);
+
+	for (std::size_t i = 0; i < EntityCount; ++i)
+	{
+		Sce::Vector2f position(static_cast<float>(std::rand() % 2000 - 1000), -static_cast<float>(std::rand() % 1000));
+		Sce::Vector2f velocity(static_cast<float>(std::rand() % 200 - 100), 0.f);
+
+		entt::entity entity = registry.create();
+		registry.emplace<Sce::Transform>(entity).SetPosition(position);
+		registry.emplace<Sce::VelocityComponent>(entity).linearVel = velocity;
+
+		entt::entity kinematicEntity = registry.create();
+		Sce::KinematicsSystem::AddKinematics(registry, kinematicEntity, position, velocity);
+	}
+
+	auto Report = [&](const char* name, float elapsedTime, float referenceTime)
+	{
+		fmt::print("{:<28} {:>8.3f} ms  x{:.2f}\n", name, elapsedTime * 1000.f, referenceTime / elapsedTime);
+	};
+
+	float referenceTime = 0.f;
+	{
+		Sce::GravitySystem gravitySystem(&registry);
+		Sce::VelocitySystem velocitySystem(&registry);
+
+		referenceTime = Measure([&]
+		{
+			gravitySystem.ApplyGravity(DeltaTime);
+			velocitySystem.ApplyVelocity(DeltaTime);
+		});
+		Report("Gravity + Velocity (AoS)", referenceTime, referenceTime);
+	}
+
+	const std::pair<Sce::SimdLevel, const char*> levels[] = {
+		{ Sce::SimdLevel::Scalar, "Kinematics scalar" },
+		{ Sce::SimdLevel::SSE2, "Kinematics SSE2" },
+		{ Sce::SimdLevel::AVX2, "Kinematics AVX2" }
+	};
+
+	for (auto&& [level, name] : levels)
+	{
+		if (level > Sce::GetSupportedSimdLevel())
+		{
+			fmt::print("{:<28} unsupported on this CPU\n", name);
+			continue;
+		}
+
+		float elapsedTime = Measure([&]
+		{
+			kinematicsSystem.Update(level, DeltaTime);
+		});
+		Report(name, elapsedTime, referenceTime);
+	}
+
+	Sce::ThreadPool threadPool;
+	Sce::KinematicsSystem parallelKinematicsSystem(&registry, &threadPool);
+
+	float parallelTime = Measure([&]
+	{
+		parallelKinematicsSystem.Update(DeltaTime);
+	});
+	Report("Kinematics (ThreadPool)", parallelTime, referenceTime);
+
+	return EXIT_SUCCESS;
+}
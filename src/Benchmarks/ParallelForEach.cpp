@@ -0,0 +1,111 @@
+#include <SuperCoco/Affine2.hpp>
+#include <SuperCoco/ParallelForEach.hpp>
+#include <SuperCoco/Stopwatch.hpp>
+#include <SuperCoco/ThreadPool.hpp>
+#include <SuperCoco/Transform.hpp>
+#include <SuperCoco/Components/VelocityComponent.hpp>
+#include <SuperCoco/Systems/GravitySystem.hpp>
+#include <SuperCoco/Systems/HierarchySystem.hpp>
+#include <SuperCoco/Systems/VelocitySystem.hpp>
+#include <entt/entt.hpp>
+#include <fmt/core.h>
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+// Mesure la montée en charge de ParallelForEach de 1 à N threads sur 100k entités (balles/particules) :
+// - gravité + vitesse au travers des systèmes du moteur (peu de calcul par entité, limité par la mémoire)
+// - un noyau plus coûteux (construction d'une matrice et transformation de quelques points par entité)
+// chaque mesure garde le meilleur temps sur plusieurs itérations
+constexpr std::size_t EntityCount = 100'000;
+constexpr int IterationCount = 20;
+
+template<typename F>
+float Measure(F&& func)
+{
+	float bestTime = 0.f;
+	for (int i = 0; i < IterationCount; ++i)
+	{
+		Sce::Stopwatch stopwatch;
+		func();
+		float elapsedTime = stopwatch.GetElapsedTime();
+
+		if (i == 0 || elapsedTime < bestTime)
+			bestTime = elapsedTime;
+	}
+
+	return bestTime;
+}
+
+int main()
+{
+	entt::registry registry;
+	Sce::HierarchySystem hierarchySystem(&registry);
+
+	for (std::size_t i = 0; i < EntityCount; ++i)
+	{
+		entt::entity entity = registry.create();
+
+		auto& transform = registry.emplace<Sce::Transform>(entity);
+		transform.SetPosition(Sce::Vector2f(static_cast<float>(std::rand() % 2000 - 1000), -static_cast<float>(std::rand() % 1000)));
+
+		auto& velocity = registry.emplace<Sce::VelocityComponent>(entity);
+		velocity.linearVel = Sce::Vector2f(static_cast<float>(std::rand() % 200 - 100), 0.f);
+	}
+
+	unsigned int maxThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+	fmt::print("{} entities, 1 to {} threads\n", EntityCount, maxThreadCount);
+
+	float referenceSystemTime = 0.f;
+	float referenceKernelTime = 0.f;
+	for (unsigned int threadCount = 1; threadCount <= maxThreadCount; ++threadCount)
+	{
+		// Le thread appelant prend part au travail : un pool de N - 1 threads donne N threads au total
+		std::unique_ptr<Sce::ThreadPool> threadPool;
+		if (threadCount > 1)
+			threadPool = std::make_unique<Sce::ThreadPool>(threadCount - 1);
+
+		float systemTime;
+		{
+			Sce::GravitySystem gravitySystem(&registry, threadPool.get());
+			Sce::VelocitySystem velocitySystem(&registry, threadPool.get());
+
+			systemTime = Measure([&]
+			{
+				gravitySystem.ApplyGravity(1.f / 60.f);
+				velocitySystem.ApplyVelocity(1.f / 60.f);
+			});
+		}
+
+		auto view = registry.view<Sce::Transform, Sce::VelocityComponent>();
+		auto Kernel = [](entt::entity /*entity*/, Sce::Transform& transform, Sce::VelocityComponent& velocity)
+		{
+			Sce::Affine2f matrix = Sce::Affine2f::MakeTransform(transform.GetPosition(), velocity.angularVel, transform.GetScale());
+
+			Sce::Vector2f sum(0.f, 0.f);
+			for (int corner = 0; corner < 16; ++corner)
+				sum += matrix.TransformPoint(Sce::Vector2f(static_cast<float>(corner), static_cast<float>(-corner)));
+
+			velocity.angularVel = sum.x * 1e-6f;
+		};
+
+		float kernelTime = Measure([&]
+		{
+			if (threadPool)
+				Sce::ParallelForEach(*threadPool, view, Kernel);
+			else
+				view.each(Kernel);
+		});
+
+		if (threadCount == 1)
+		{
+			referenceSystemTime = systemTime;
+			referenceKernelTime = kernelTime;
+		}
+
+		fmt::print("{:>2} threads  gravity+velocity {:>8.3f} ms x{:<5.2f}  kernel {:>8.3f} ms x{:<5.2f}\n", threadCount, systemTime * 1000.f, referenceSystemTime / systemTime, kernelTime * 1000.f, referenceKernelTime / kernelTime);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+#include <SuperCoco/ComponentRegistry.hpp>
+#include <SuperCoco/NameComponent.hpp>
+#include <SuperCoco/SceneSerializer.hpp>
+#include <SuperCoco/Stopwatch.hpp>
+#include <SuperCoco/Transform.hpp>
+#include <SuperCoco/Components/VelocityComponent.hpp>
+#include <SuperCoco/Systems/HierarchySystem.hpp>
+#include <entt/entt.hpp>
+#include <fmt/core.h>
+#include <nlohmann/json.hpp>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Compare le chargement d'une scène de 100k entités (nom, Transform, vitesse, une entité sur dix rattachée à un parent)
+// depuis le JSON de l'éditeur (parsing + désérialisation entité par entité) et depuis le format binaire en colonnes (.bscene) ;
+// chaque mesure garde le meilleur temps sur plusieurs itérations, dans un registre neuf à chaque fois
+constexpr std::size_t EntityCount = 100'000;
+constexpr int IterationCount = 5;
+
+template<typename F>
+float Measure(F&& load)
+{
+	float bestTime = 0.f;
+	for (int i = 0; i < IterationCount; ++i)
+	{
+		entt::registry registry;
+		Sce::HierarchySystem hierarchySystem(&registry);
+
+		Sce::Stopwatch stopwatch;
+		load(registry);
+		float elapsedTime = stopwatch.GetElapsedTime();
+
+		if (i == 0 || elapsedTime < bestTime)
+			bestTime = elapsedTime;
+	}
+
+	return bestTime;
+}
+
+int main()
+{
+	Sce::ComponentRegistry componentRegistry;
+
+	entt::registry sourceRegistry;
+	Sce::HierarchySystem sourceHierarchySystem(&sourceRegistry);
+
+	std::vector<entt::entity> entities(EntityCount);
+	sourceRegistry.create(entities.begin(), entities.end());
+	for (std::size_t i = 0; i < EntityCount; ++i)
+	{
+		entt::entity entity = entities[i];
+		sourceRegistry.emplace<Sce::NameComponent>(entity, "Entity " + std::to_string(i));
+		sourceRegistry.emplace<Sce::Transform>(entity).SetPosition({ static_cast<float>(std::rand() % 2000 - 1000), static_cast<float>(std::rand() % 2000 - 1000) });
+		sourceRegistry.emplace<Sce::VelocityComponent>(entity).linearVel = { static_cast<float>(std::rand() % 200 - 100), 0.f };
+	}
+
+	std::vector<std::pair<std::size_t, std::size_t>> hierarchies;
+	for (std::size_t i = 10; i < EntityCount; i += 10)
+	{
+		sourceRegistry.get<Sce::Transform>(entities[i]).SetParent(&sourceRegistry.get<Sce::Transform>(entities[i - 1]));
+		hierarchies.emplace_back(i - 1, i);
+	}
+
+	// Même document que WorldEditor::SaveScene, gardé en mémoire pour ne mesurer que le parsing et la désérialisation
+	nlohmann::json entityArray = nlohmann::json::array();
+	for (entt::entity entity : entities)
+	{
+		nlohmann::json entityDoc;
+		componentRegistry.ForEachComponent([&](const Sce::ComponentRegistry::Entry& entry)
+		{
+			entt::handle entityHandle(sourceRegistry, entity);
+			if (entry.hasComponent && entry.hasComponent(entityHandle) && entry.serialize)
+				entityDoc[entry.id] = entry.serialize(entityHandle);
+		});
+
+		entityArray.push_back(std::move(entityDoc));
+	}
+
+	nlohmann::json hierarchiesDoc = nlohmann::json::array();
+	for (auto&& [parentIndex, childIndex] : hierarchies)
+		hierarchiesDoc.push_back({ { "Parent", parentIndex }, { "Child", childIndex } });
+
+	nlohmann::json sceneDoc;
+	sceneDoc["Entities"] = std::move(entityArray);
+	sceneDoc["Hierarchies"] = std::move(hierarchiesDoc);
+	std::string sceneJson = sceneDoc.dump(1, '\t');
+
+	std::string scenePath = (std::filesystem::temp_directory_path() / "SceBenchSceneLoading.bscene").string();
+	if (!Sce::SceneSerializer::SaveBinary(sourceRegistry, componentRegistry, scenePath))
+		return EXIT_FAILURE;
+
+	fmt::print("{} entities: JSON {:.1f} MiB, binary {:.1f} MiB\n", EntityCount, sceneJson.size() / (1024.f * 1024.f), std::filesystem::file_size(scenePath) / (1024.f * 1024.f));
+
+	auto Report = [&](const char* name, float elapsedTime, float referenceTime)
+	{
+		fmt::print("{:<28} {:>9.3f} ms  x{:.2f}\n", name, elapsedTime * 1000.f, referenceTime / elapsedTime);
+	};
+
+	float referenceTime = Measure([&](entt::registry& registry)
+	{
+		nlohmann::json doc = nlohmann::json::parse(sceneJson);
+
+		std::vector<entt::entity> indexToEntity;
+		for (const nlohmann::json& entityDoc : doc["Entities"])
+		{
+			entt::handle entityHandle(registry, registry.create());
+			indexToEntity.push_back(entityHandle);
+
+			componentRegistry.ForEachComponent([&](const Sce::ComponentRegistry::Entry& entry)
+			{
+				if (!entry.unserialize)
+					return;
+
+				auto it = entityDoc.find(entry.id);
+				if (it != entityDoc.end())
+					entry.unserialize(entityHandle, it.value());
+			});
+		}
+
+		for (const nlohmann::json& hierarchyDoc : doc["Hierarchies"])
+		{
+			Sce::Transform& parentTransform = registry.get<Sce::Transform>(indexToEntity[hierarchyDoc["Parent"].get<std::size_t>()]);
+			registry.get<Sce::Transform>(indexToEntity[hierarchyDoc["Child"].get<std::size_t>()]).SetParent(&parentTransform);
+		}
+	});
+	Report("JSON (WorldEditor)", referenceTime, referenceTime);
+
+	float binaryTime = Measure([&](entt::registry& registry)
+	{
+		Sce::SceneSerializer::LoadBinary(registry, componentRegistry, scenePath);
+	});
+	Report("Binary columns (.bscene)", binaryTime, referenceTime);
+
+	std::filesystem::remove(scenePath);
+
+	return EXIT_SUCCESS;
+}
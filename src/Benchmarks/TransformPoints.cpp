@@ -0,0 +1,115 @@
+#include <SuperCoco/Affine2.hpp>
+#include <SuperCoco/Matrix.hpp>
+#include <SuperCoco/Stopwatch.hpp>
+#include <SuperCoco/VertexTransform.hpp>
+#include <SDL2/SDL_render.h>
+#include <fmt/core.h>
+#include <cstdlib>
+#include <vector>
+
+// Compare le chemin historique de Model::Render (une Matrixf allouée et multipliée par point) aux différentes implémentations
+// de Sce::TransformPoints sur 1M de points ; chaque mesure garde le meilleur temps sur plusieurs itérations
+constexpr std::size_t PointCount = 1'000'000;
+constexpr int IterationCount = 10;
+
+template<typename F>
+float Measure(F&& func)
+{
+	float bestTime = 0.f;
+	for (int i = 0; i < IterationCount; ++i)
+	{
+		Sce::Stopwatch stopwatch;
+		func();
+		float elapsedTime = stopwatch.GetElapsedTime();
+
+		if (i == 0 || elapsedTime < bestTime)
+			bestTime = elapsedTime;
+	}
+
+	return bestTime;
+}
+
+float Checksum(const std::vector<SDL_Vertex>& vertices)
+{
+	// Empêche le compilateur d'éliminer les calculs et permet de vérifier que toutes les versions donnent le même résultat
+	float sum = 0.f;
+	for (const SDL_Vertex& vertex : vertices)
+		sum += vertex.position.x + vertex.position.y;
+
+	return sum;
+}
+
+int main()
+{
+	std::vector<Sce::Vector2f> points(PointCount);
+	for (Sce::Vector2f& point : points)
+		point = Sce::Vector2f(static_cast<float>(std::rand() % 2000 - 1000), static_cast<float>(std::rand() % 2000 - 1000));
+
+	std::vector<SDL_Vertex> vertices(PointCount);
+
+	Sce::Vector2f position(540.f, 384.f);
+	float rotation = 30.f;
+	Sce::Vector2f scale(2.f, 0.5f);
+
+	Sce::Matrixf matrix = Sce::Matrixf::MakeTransform3x3(position, rotation, scale);
+	Sce::Affine2f affine = Sce::Affine2f::MakeTransform(position, rotation, scale);
+
+	auto Report = [&](const char* name, float elapsedTime, float referenceTime)
+	{
+		fmt::print("{:<24} {:>8.3f} ms  x{:<6.2f} checksum {}\n", name, elapsedTime * 1000.f, referenceTime / elapsedTime, Checksum(vertices));
+	};
+
+	// Chemin d'origine : chaque point devient une matrice de translation (allouée sur le tas) multipliée par la transformation
+	float referenceTime = Measure([&]
+	{
+		for (std::size_t i = 0; i < PointCount; ++i)
+		{
+			Sce::Vector2f transformed = (matrix * Sce::Matrixf::MakeFromPosition(points[i])).GetVector2();
+			vertices[i].position = SDL_FPoint{ transformed.x, transformed.y };
+		}
+	});
+	Report("Matrixf (original)", referenceTime, referenceTime);
+
+	float matrixTime = Measure([&]
+	{
+		for (std::size_t i = 0; i < PointCount; ++i)
+		{
+			Sce::Vector2f transformed = matrix * points[i];
+			vertices[i].position = SDL_FPoint{ transformed.x, transformed.y };
+		}
+	});
+	Report("Matrixf * Vector2f", matrixTime, referenceTime);
+
+	float affineTime = Measure([&]
+	{
+		for (std::size_t i = 0; i < PointCount; ++i)
+		{
+			Sce::Vector2f transformed = affine * points[i];
+			vertices[i].position = SDL_FPoint{ transformed.x, transformed.y };
+		}
+	});
+	Report("Affine2f (per point)", affineTime, referenceTime);
+
+	const std::pair<Sce::SimdLevel, const char*> levels[] = {
+		{ Sce::SimdLevel::Scalar, "TransformPoints scalar" },
+		{ Sce::SimdLevel::SSE2, "TransformPoints SSE2" },
+		{ Sce::SimdLevel::AVX2, "TransformPoints AVX2" }
+	};
+
+	for (auto&& [level, name] : levels)
+	{
+		if (level > Sce::GetSupportedSimdLevel())
+		{
+			fmt::print("{:<24} unsupported on this CPU\n", name);
+			continue;
+		}
+
+		float elapsedTime = Measure([&]
+		{
+			Sce::TransformPoints(level, affine, points.data(), vertices.data(), PointCount);
+		});
+		Report(name, elapsedTime, referenceTime);
+	}
+
+	return EXIT_SUCCESS;
+}
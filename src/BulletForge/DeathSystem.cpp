@@ -1,22 +1,47 @@
 #include <BulletForge/DeathSystem.hpp>
 #include <BulletForge/DeathComponent.hpp>
+#include <SuperCoco/EntityCommandBuffer.hpp>
+#include <SuperCoco/EntityPool.hpp>
+#include <SuperCoco/Components/PoolComponents.hpp>
 #include <entt/entt.hpp>
+#include <vector>
 
 namespace BulletForge
 {
-	DeathSystem::DeathSystem(entt::registry* registry ) :
-	m_registry(registry)
+	DeathSystem::DeathSystem(entt::registry* registry, Sce::EntityCommandBuffer* commandBuffer) :
+	m_registry(registry),
+	m_commandBuffer(commandBuffer)
 	{
 	}
 
 	void DeathSystem::DeathNote()
 	{
+		// Détruire pendant le parcours invaliderait la vue : les entités sont détruites d'un bloc au prochain Playback
 		auto view = m_registry->view<DeathComponent>();
-		for (auto&& [entity] : view.each())
+
+		// Les entités issues d'un pool y retournent (désactivées, leurs ressources sont gardées pour la prochaine apparition)
+		std::vector<entt::entity> destroyedEntities;
+		destroyedEntities.reserve(view.size());
+		for (entt::entity entity : view)
 		{
-			if(m_registry->valid(entity))
-				m_registry->destroy(entity);
+			const Sce::PooledComponent* pooled = m_registry->try_get<Sce::PooledComponent>(entity);
+			if (!pooled)
+			{
+				destroyedEntities.push_back(entity);
+				continue;
+			}
+
+			m_commandBuffer->Defer([entity, pool = pooled->pool](entt::registry& registry)
+			{
+				if (!registry.valid(entity))
+					return;
+
+				registry.remove<DeathComponent>(entity);
+				pool->Release(entity);
+			});
 		}
+
+		m_commandBuffer->Destroy(destroyedEntities.begin(), destroyedEntities.end());
 	}
 
 }
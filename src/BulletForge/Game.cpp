@@ -8,6 +8,7 @@
 #include <SuperCoco/CollisionShape.hpp>
 #include <SuperCoco/Maths.hpp>
 #include <SuperCoco/Components/GraphicsComponent.hpp>
+#include <SuperCoco/Components/PoolComponents.hpp>
 #include <SuperCoco/Components/RigidBodyComponent.hpp>
 #include <SuperCoco/Components/SpritesheetComponent.hpp>
 #include <fmt/core.h>
@@ -17,7 +18,8 @@ namespace BulletForge
 {
 	Game* Game::s_instance = nullptr;
 
-	Game::Game()
+	Game::Game(const Sce::ComponentRegistry& componentRegistry) :
+	m_componentRegistry(componentRegistry)
 	{
 		if (s_instance != nullptr)
 			throw std::runtime_error("There is more than 1 game object");
@@ -87,11 +89,150 @@ namespace BulletForge
 		return entt::handle{ world, entity };
 	}
 
-	entt::handle Game::CreateEnemy(entt::registry& world, Sce::Renderer& renderer, EnemyType type, Sce::Vector2f position, int layer, Sce::Core& core)
+	entt::handle Game::CreateEnemy(entt::registry& world, Sce::Renderer& renderer, EnemyType type, Sce::Vector2f position, int layer, Sce::Core& core, Sce::EntityCommandBuffer& commandBuffer)
 	{
-		entt::entity entity = world.create();
+		std::vector<entt::entity> enemies = CreateEnemies(world, renderer, type, std::span<const Sce::Vector2f>(&position, 1), layer, core, commandBuffer);
+		return entt::handle{ world, enemies.front() };
+	}
 
-		auto& transform = world.emplace<Sce::Transform>(entity);
+	std::vector<entt::entity> Game::CreateEnemies(entt::registry& world, Sce::Renderer& renderer, EnemyType type, std::span<const Sce::Vector2f> positions, int layer, Sce::Core& core, Sce::EntityCommandBuffer& commandBuffer)
+	{
+		std::vector<entt::entity> enemies(positions.size());
+		GetEnemyPool(world, renderer, type, layer, core, commandBuffer).Acquire(enemies);
+
+		for (std::size_t i = 0; i < enemies.size(); ++i)
+			world.get<Sce::RigidBodyComponent>(enemies[i]).TeleportTo(positions[i]);
+
+		return enemies;
+	}
+
+	entt::handle Game::CreateHitText(entt::registry& world, Sce::Core& core, const Sce::Vector2f& position)
+	{
+		// Le texte ne change jamais : la texture rendue est gardée d'une apparition à l'autre
+		if (!m_hitTextPool)
+		{
+			m_hitTextPool.emplace(world, [&core](entt::registry& registry, std::span<entt::entity> texts)
+			{
+				for (entt::entity& text : texts)
+					text = core.CreateText(registry, "Ouch", { 0.f, 0.f }).entity();
+			});
+		}
+
+		entt::handle text = m_hitTextPool->Acquire();
+
+		Sce::Transform& transform = text.get<Sce::Transform>();
+		transform.SetPosition(position);
+		transform.SetScale({ 1.f, 1.f });
+
+		return text;
+	}
+
+	Sce::EntityPool::Stats Game::GetEnemyPoolStats() const
+	{
+		Sce::EntityPool::Stats stats;
+		for (const auto& [key, pool] : m_enemyPools)
+		{
+			const Sce::EntityPool::Stats& poolStats = pool.GetStats();
+			stats.acquireCount += poolStats.acquireCount;
+			stats.hitCount += poolStats.hitCount;
+			stats.releaseCount += poolStats.releaseCount;
+			stats.pooledCount += poolStats.pooledCount;
+		}
+
+		return stats;
+	}
+
+	Sce::EntityPool::Stats Game::GetHitTextPoolStats() const
+	{
+		if (!m_hitTextPool)
+			return {};
+
+		return m_hitTextPool->GetStats();
+	}
+
+	Sce::EntityPool& Game::GetEnemyPool(entt::registry& world, Sce::Renderer& renderer, EnemyType type, int layer, Sce::Core& core, Sce::EntityCommandBuffer& commandBuffer)
+	{
+		auto it = m_enemyPools.find({ type, layer });
+		if (it != m_enemyPools.end())
+			return it->second;
+
+		const Sce::Prefab& prefab = GetEnemyPrefab(renderer, type, layer);
+		auto createEnemies = [this, &prefab, &core, &commandBuffer](entt::registry& registry, std::span<entt::entity> enemies)
+		{
+			// Transform et sprite viennent du prefab (ajoutés par plages, texture partagée),
+			// seuls les corps physiques et les callbacks, propres à chaque ennemi, sont construits un par un.
+			// Ils ne le sont qu'une fois : un ennemi recyclé garde son corps, ses shapes et ses callbacks
+			prefab.Instantiate(registry, enemies);
+
+			registry.insert<HealthComponent>(enemies.begin(), enemies.end(), HealthComponent(100.f));
+
+			for (entt::entity entity : enemies)
+			{
+				auto ondeath = [entity, &commandBuffer]
+					{
+						commandBuffer.Emplace<DeathComponent>(entity);
+					};
+				registry.get<HealthComponent>(entity).SetOnDeathCallback(ondeath);
+
+				// Appelé pendant cpSpaceStep : les créations et ajouts de composants passent par le buffer de commandes
+				std::function<void()> collisionLambda = [this, entity, &core, &registry, &commandBuffer]()
+					{
+						Sce::Transform& eTransform = registry.get<Sce::Transform>(entity);
+						Sce::Vector2f textPosition = eTransform.GetPosition() + Sce::Vector2f{0.f, -48.f};
+						commandBuffer.Defer([this, &core, &commandBuffer, textPosition](entt::registry& registry)
+						{
+							entt::handle text = CreateHitText(registry, core, textPosition);
+
+							std::uint32_t generation = Sce::EntityPool::GetGeneration(registry, text);
+							Sce::TimerManager::CreateTimer(.25f,
+							[text, generation, &registry, &commandBuffer]
+							{
+								if (Sce::EntityPool::IsAlive(registry, text, generation))
+									commandBuffer.Emplace<DeathComponent>(text);
+							}, 0.75f);
+						});
+
+						HealthComponent& ehp = registry.get<HealthComponent>(entity);
+						ehp.ModifyHealth(-50.f);
+
+						std::uint32_t generation = Sce::EntityPool::GetGeneration(registry, entity);
+						Sce::TimerManager::CreateContinuousTimer(0.75f, [entity, generation, &registry](float delta, float current)
+						{
+							// Un ennemi tué est rendu à son pool, et peut en être ressorti (même identifiant) avant la fin du timer
+							if (!Sce::EntityPool::IsAlive(registry, entity, generation))
+								return;
+
+							Sce::Transform& transform = registry.get<Sce::Transform>(entity);
+							float progress = Sce::Maths::EaseOutBack(current / 0.75f);
+							transform.SetScale({ progress, progress });
+						});
+					};
+				auto col = [](cpArbiter* arb, cpSpace* space, void* data) -> cpBool { return true; };
+				auto& rb = registry.emplace<Sce::RigidBodyComponent>(entity, 10.f, 0.0f, collisionLambda);
+				rb.AddShape(std::make_shared<Sce::BoxShape>(48.f, 48.f), Sce::Vector2f{0.f,0.f }, col);
+				rb.SetSensor(true);
+				rb.SetTag(Sce::Tag::Enemy);
+			}
+		};
+
+		auto resetEnemy = [](entt::handle enemy)
+		{
+			enemy.get<HealthComponent>().Restore();
+			enemy.get<Sce::Transform>().SetScale({ 1.f, 1.f });
+
+			auto& rb = enemy.get<Sce::RigidBodyComponent>();
+			rb.SetLinearVelocity({ 0.f, 0.f });
+			rb.SetAngularVelocity(0.f);
+		};
+
+		return m_enemyPools.try_emplace(std::make_pair(type, layer), world, std::move(createEnemies), std::move(resetEnemy)).first->second;
+	}
+
+	const Sce::Prefab& Game::GetEnemyPrefab(Sce::Renderer& renderer, EnemyType type, int layer)
+	{
+		auto it = m_enemyPrefabs.find({ type, layer });
+		if (it != m_enemyPrefabs.end())
+			return it->second;
 
 		SDL_Rect enemyRect = { 16 * 2, 16 * 10, 16, 16 };
 		switch (type)
@@ -113,51 +254,12 @@ namespace BulletForge
 				break;
 		}
 
-		std::shared_ptr<Sce::Sprite> sprite = BuildTileSprite(renderer, enemyRect, { 0.5f, 0.5f }, layer);
-		auto& gcomponent = world.emplace<Sce::GraphicsComponent>(entity);
-		gcomponent.m_renderable = sprite;
-
-		auto ondeath = [entity, &world]
-			{
-				world.emplace<DeathComponent>(entity);
-			};
-		auto& hcomp = world.emplace<HealthComponent>(entity, 100.f);
-		hcomp.SetOnDeathCallback(ondeath);
-
-		std::function<void()> collisionLambda = [entity, &core, &world]()
-			{
-				Sce::Transform& eTransform = world.get<Sce::Transform>(entity);
-				entt::handle text = core.CreateText(world, "Ouch", eTransform.GetPosition() + Sce::Vector2f{0.f, -48.f});
-
-				HealthComponent& ehp = world.get<HealthComponent>(entity);
-				ehp.ModifyHealth(-50.f);
-
-				Sce::TimerManager::CreateContinuousTimer(0.75f, [entity, &world](float delta, float current)
-				{
-					if (!world.valid(entity))
-						return;
-					Sce::Transform& transform = world.get<Sce::Transform>(entity);
-					float progress = Sce::Maths::EaseOutBack(current / 0.75f);
-					transform.SetScale({ progress, progress });
-				});
-
-				Sce::TimerManager::CreateTimer(.25f,
-				[text, &world]
-				{
-					if(world.valid(text))
-						world.emplace<DeathComponent>(text);
-				}, 0.75f);
-			};
-		auto col = [](cpArbiter* arb, cpSpace* space, void* data) -> cpBool { return true; };
-		auto& rb = world.emplace<Sce::RigidBodyComponent>(entity, 10.f, 0.0f, collisionLambda);
-		rb.AddShape(std::make_shared<Sce::BoxShape>(48.f, 48.f), Sce::Vector2f{0.f,0.f }, col);
-		rb.SetSensor(true);
-		rb.SetTag(Sce::Tag::Enemy);
-		rb.TeleportTo(position);
+		Sce::Prefab prefab(m_componentRegistry);
+		entt::handle prototype = prefab.GetPrototype();
+		prototype.emplace<Sce::Transform>();
+		prototype.emplace<Sce::GraphicsComponent>().m_renderable = BuildTileSprite(renderer, enemyRect, { 0.5f, 0.5f }, layer);
 
-
-
-		return entt::handle{ world, entity };
+		return m_enemyPrefabs.emplace(std::make_pair(type, layer), std::move(prefab)).first->second;
 	}
 
 	std::shared_ptr<Sce::Sprite> Game::BuildPlayerSprite(Sce::Renderer& renderer, int layer)
@@ -21,6 +21,11 @@ namespace BulletForge
 			m_onDeath();
 	}
 
+	void HealthComponent::Restore()
+	{
+		m_currentHealth = m_maxHealth;
+	}
+
 	void HealthComponent::SetOnDeathCallback(std::function<void()> callback)
 	{
 		m_onDeath = std::move(callback);
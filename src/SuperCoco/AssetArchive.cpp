@@ -0,0 +1,258 @@
+#include <SuperCoco/AssetArchive.hpp>
+#include <fmt/color.h>
+#include <fmt/core.h>
+#include <lz4.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace Sce
+{
+	constexpr std::array<char, 4> ArchiveMagic = { 'S', 'C', 'P', 'K' };
+	constexpr std::uint32_t ArchiveVersion = 1;
+	constexpr std::uint64_t DataAlignment = 16;
+
+	namespace
+	{
+		// Seuls les formats texte gagnent à être compressés, les PNG le sont déjà et les polices doivent
+		// rester dans la projection (SDL_ttf les lit pendant toute leur durée de vie)
+		bool IsCompressible(const std::string& filepath)
+		{
+			std::string extension = std::filesystem::path(filepath).extension().string();
+			return extension == ".json" || extension == ".model" || extension == ".spritesheet" || extension == ".lua" || extension == ".txt";
+		}
+	}
+
+	AssetArchive::AssetArchive(MappedFile mappedFile) :
+	m_mappedFile(std::move(mappedFile))
+	{
+	}
+
+	bool AssetArchive::Contains(const std::string& filepath) const
+	{
+		return FindEntry(filepath) != nullptr;
+	}
+
+	std::size_t AssetArchive::GetEntryCount() const
+	{
+		return m_entries.size();
+	}
+
+	std::vector<std::string> AssetArchive::GetPaths() const
+	{
+		std::vector<std::string> paths;
+		paths.reserve(m_entries.size());
+		for (const TocEntry& entry : m_entries)
+			paths.emplace_back(&m_pathTable[entry.pathOffset]);
+
+		return paths;
+	}
+
+	std::optional<std::span<const std::uint8_t>> AssetArchive::Read(const std::string& filepath, std::vector<std::uint8_t>& buffer) const
+	{
+		const TocEntry* entry = FindEntry(filepath);
+		if (!entry)
+			return {};
+
+		std::span<const std::uint8_t> storedData = m_mappedFile.GetData().subspan(entry->dataOffset, entry->storedSize);
+		if ((entry->flags & EntryFlag_LZ4) == 0)
+			return storedData;
+
+		buffer.resize(entry->originalSize);
+		int decompressedSize = LZ4_decompress_safe(reinterpret_cast<const char*>(storedData.data()), reinterpret_cast<char*>(buffer.data()), static_cast<int>(storedData.size()), static_cast<int>(buffer.size()));
+		if (decompressedSize < 0 || static_cast<std::uint64_t>(decompressedSize) != entry->originalSize)
+			throw std::runtime_error("corrupt archive entry " + filepath);
+
+		return std::span<const std::uint8_t>(buffer.data(), buffer.size());
+	}
+
+	const AssetArchive::TocEntry* AssetArchive::FindEntry(const std::string& filepath) const
+	{
+		std::string normalizedPath = NormalizePath(filepath);
+		std::uint64_t pathHash = HashPath(normalizedPath);
+
+		auto it = std::lower_bound(m_entries.begin(), m_entries.end(), pathHash, [](const TocEntry& entry, std::uint64_t hash)
+		{
+			return entry.pathHash < hash;
+		});
+
+		// On compare aussi le chemin pour se prémunir des collisions
+		for (; it != m_entries.end() && it->pathHash == pathHash; ++it)
+		{
+			if (normalizedPath == &m_pathTable[it->pathOffset])
+				return &*it;
+		}
+
+		return nullptr;
+	}
+
+	bool AssetArchive::BuildToFile(const std::vector<std::string>& filepaths, const std::string& archivePath, bool compressTextFiles)
+	{
+		struct PendingEntry
+		{
+			TocEntry tocEntry;
+			std::vector<std::uint8_t> data;
+		};
+
+		std::vector<PendingEntry> entries;
+		std::string pathTable;
+		for (const std::string& filepath : filepaths)
+		{
+			std::ifstream inputFile(filepath, std::ios::binary);
+			if (!inputFile)
+			{
+				fmt::print(fg(fmt::color::red), "failed to open {}\n", filepath);
+				return false;
+			}
+
+			std::vector<std::uint8_t> content((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
+
+			std::string normalizedPath = NormalizePath(filepath);
+
+			PendingEntry& entry = entries.emplace_back();
+			entry.tocEntry.pathHash = HashPath(normalizedPath);
+			entry.tocEntry.pathOffset = static_cast<std::uint32_t>(pathTable.size());
+			entry.tocEntry.originalSize = content.size();
+			entry.tocEntry.flags = 0;
+
+			pathTable += normalizedPath;
+			pathTable.push_back('\0');
+
+			if (compressTextFiles && IsCompressible(normalizedPath) && !content.empty())
+			{
+				std::vector<std::uint8_t> compressed(LZ4_compressBound(static_cast<int>(content.size())));
+				int compressedSize = LZ4_compress_default(reinterpret_cast<const char*>(content.data()), reinterpret_cast<char*>(compressed.data()), static_cast<int>(content.size()), static_cast<int>(compressed.size()));
+
+				// On ne garde la version compressée que si elle est réellement plus petite
+				if (compressedSize > 0 && static_cast<std::size_t>(compressedSize) < content.size())
+				{
+					compressed.resize(compressedSize);
+					content = std::move(compressed);
+					entry.tocEntry.flags |= EntryFlag_LZ4;
+				}
+			}
+
+			entry.tocEntry.storedSize = content.size();
+			entry.data = std::move(content);
+		}
+
+		std::sort(entries.begin(), entries.end(), [](const PendingEntry& lhs, const PendingEntry& rhs)
+		{
+			return lhs.tocEntry.pathHash < rhs.tocEntry.pathHash;
+		});
+
+		for (std::size_t i = 1; i < entries.size(); ++i)
+		{
+			if (entries[i].tocEntry.pathHash == entries[i - 1].tocEntry.pathHash && std::strcmp(&pathTable[entries[i].tocEntry.pathOffset], &pathTable[entries[i - 1].tocEntry.pathOffset]) == 0)
+			{
+				fmt::print(fg(fmt::color::red), "{} is present twice\n", &pathTable[entries[i].tocEntry.pathOffset]);
+				return false;
+			}
+		}
+
+		Header header;
+		std::memcpy(header.magic, ArchiveMagic.data(), ArchiveMagic.size());
+		header.version = ArchiveVersion;
+		header.entryCount = static_cast<std::uint32_t>(entries.size());
+		header.pathTableSize = static_cast<std::uint32_t>(pathTable.size());
+
+		auto alignOffset = [](std::uint64_t offset)
+		{
+			return (offset + DataAlignment - 1) / DataAlignment * DataAlignment;
+		};
+
+		std::uint64_t dataOffset = alignOffset(sizeof(Header) + entries.size() * sizeof(TocEntry) + pathTable.size());
+		for (PendingEntry& entry : entries)
+		{
+			entry.tocEntry.dataOffset = dataOffset;
+			dataOffset = alignOffset(dataOffset + entry.tocEntry.storedSize);
+		}
+
+		std::ofstream outputFile(archivePath, std::ios::binary | std::ios::trunc);
+		if (!outputFile)
+		{
+			fmt::print(fg(fmt::color::red), "failed to open {}\n", archivePath);
+			return false;
+		}
+
+		outputFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		for (const PendingEntry& entry : entries)
+			outputFile.write(reinterpret_cast<const char*>(&entry.tocEntry), sizeof(entry.tocEntry));
+
+		outputFile.write(pathTable.data(), pathTable.size());
+
+		for (const PendingEntry& entry : entries)
+		{
+			// Remplissage jusqu'au début aligné des données
+			static constexpr std::array<char, DataAlignment> padding = {};
+			std::uint64_t currentOffset = static_cast<std::uint64_t>(outputFile.tellp());
+			outputFile.write(padding.data(), entry.tocEntry.dataOffset - currentOffset);
+
+			outputFile.write(reinterpret_cast<const char*>(entry.data.data()), entry.data.size());
+		}
+
+		return outputFile.good();
+	}
+
+	AssetArchive AssetArchive::Open(const std::string& archivePath)
+	{
+		AssetArchive archive(MappedFile::Open(archivePath));
+
+		std::span<const std::uint8_t> data = archive.m_mappedFile.GetData();
+		if (data.size() < sizeof(Header))
+			throw std::runtime_error(archivePath + " is not an asset archive");
+
+		Header header;
+		std::memcpy(&header, data.data(), sizeof(Header));
+		if (std::memcmp(header.magic, ArchiveMagic.data(), ArchiveMagic.size()) != 0)
+			throw std::runtime_error(archivePath + " is not an asset archive");
+
+		if (header.version > ArchiveVersion)
+			throw std::runtime_error(fmt::format("{} has an unknown archive version {}", archivePath, header.version));
+
+		std::uint64_t tocSize = std::uint64_t(header.entryCount) * sizeof(TocEntry);
+		if (data.size() < sizeof(Header) + tocSize + header.pathTableSize)
+			throw std::runtime_error(archivePath + " is truncated");
+
+		// La projection est alignée sur une page et le header fait 16 octets : la table est utilisable directement
+		archive.m_entries = std::span<const TocEntry>(reinterpret_cast<const TocEntry*>(data.data() + sizeof(Header)), header.entryCount);
+		archive.m_pathTable = std::span<const char>(reinterpret_cast<const char*>(data.data() + sizeof(Header) + tocSize), header.pathTableSize);
+
+		for (const TocEntry& entry : archive.m_entries)
+		{
+			if (entry.dataOffset + entry.storedSize > data.size() || entry.pathOffset >= header.pathTableSize)
+				throw std::runtime_error(archivePath + " is corrupt");
+		}
+
+		if (!archive.m_pathTable.empty() && archive.m_pathTable.back() != '\0')
+			throw std::runtime_error(archivePath + " is corrupt");
+
+		return archive;
+	}
+
+	std::uint64_t AssetArchive::HashPath(const std::string& filepath)
+	{
+		// FNV-1a 64 bits
+		std::uint64_t hash = 14695981039346656037ull;
+		for (char c : filepath)
+		{
+			hash ^= static_cast<std::uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	std::string AssetArchive::NormalizePath(const std::string& filepath)
+	{
+		// "assets/./a.png", "./assets/a.png" et "assets/a.png" désignent le même fichier
+		std::string normalizedPath = std::filesystem::path(filepath).lexically_normal().generic_string();
+		while (normalizedPath.starts_with("./"))
+			normalizedPath.erase(0, 2);
+
+		return normalizedPath;
+	}
+}
@@ -0,0 +1,284 @@
+#include <SuperCoco/BinarySerializer.hpp>
+#include <algorithm>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+
+namespace Sce
+{
+	BinaryWriter::BinaryWriter() :
+	m_stream(nullptr),
+	m_chunkSize(0),
+	m_size(0),
+	m_flushedSize(0)
+	{
+	}
+
+	BinaryWriter::BinaryWriter(std::ostream& stream, std::size_t chunkSize) :
+	m_buffer(chunkSize),
+	m_stream(&stream),
+	m_chunkSize(chunkSize),
+	m_size(0),
+	m_flushedSize(0)
+	{
+	}
+
+	BinaryWriter::~BinaryWriter()
+	{
+		try
+		{
+			Flush();
+		}
+		catch (const std::exception&)
+		{
+			// Un destructeur ne doit pas lancer d'exception, appeler Flush() explicitement pour être prévenu d'une erreur
+		}
+	}
+
+	void BinaryWriter::Flush()
+	{
+		if (!m_stream || m_size == 0)
+			return;
+
+		m_stream->write(reinterpret_cast<const char*>(m_buffer.data()), m_size);
+		m_flushedSize += m_size;
+		m_size = 0;
+
+		if (!*m_stream)
+			throw std::runtime_error("failed to write binary stream");
+	}
+
+	std::span<const std::uint8_t> BinaryWriter::GetData() const
+	{
+		return std::span<const std::uint8_t>(m_buffer.data(), m_size);
+	}
+
+	std::uint64_t BinaryWriter::GetPosition() const
+	{
+		return m_flushedSize + m_size;
+	}
+
+	void BinaryWriter::Reserve(std::size_t size)
+	{
+		if (m_size + size > m_buffer.size())
+			m_buffer.resize(m_size + size);
+	}
+
+	std::vector<std::uint8_t> BinaryWriter::TakeData()
+	{
+		m_buffer.resize(m_size);
+		m_flushedSize += m_size;
+		m_size = 0;
+
+		return std::move(m_buffer);
+	}
+
+	void BinaryWriter::WriteBytes(const void* data, std::size_t size)
+	{
+		if (size == 0)
+			return;
+
+		// En flux, un bloc plus grand que le buffer est envoyé directement sans passer par lui
+		if (m_stream && size >= m_chunkSize)
+		{
+			Flush();
+
+			m_stream->write(static_cast<const char*>(data), size);
+			m_flushedSize += size;
+
+			if (!*m_stream)
+				throw std::runtime_error("failed to write binary stream");
+
+			return;
+		}
+
+		std::memcpy(Allocate(size), data, size);
+	}
+
+	void BinaryWriter::WritePadding(std::size_t alignment)
+	{
+		std::size_t paddingSize = static_cast<std::size_t>((alignment - GetPosition() % alignment) % alignment);
+		if (paddingSize > 0)
+			std::memset(Allocate(paddingSize), 0, paddingSize);
+	}
+
+	void BinaryWriter::WriteString(std::string_view value)
+	{
+		WriteVarUInt(value.size());
+		WriteBytes(value.data(), value.size());
+	}
+
+	void BinaryWriter::WriteVarUInt(std::uint64_t value)
+	{
+		// 7 bits par octet, le bit de poids fort indique qu'un autre octet suit
+		std::uint8_t bytes[10];
+		std::size_t byteCount = 0;
+		do
+		{
+			std::uint8_t byte = static_cast<std::uint8_t>(value & 0x7F);
+			value >>= 7;
+			if (value != 0)
+				byte |= 0x80;
+
+			bytes[byteCount++] = byte;
+		}
+		while (value != 0);
+
+		std::memcpy(Allocate(byteCount), bytes, byteCount);
+	}
+
+	std::uint8_t* BinaryWriter::Allocate(std::size_t size)
+	{
+		if (m_stream && m_size + size > m_chunkSize)
+			Flush();
+
+		// Croissance géométrique : le nombre de réallocations est logarithmique en la taille finale
+		std::size_t requiredSize = m_size + size;
+		if (requiredSize > m_buffer.size())
+			m_buffer.resize(std::max(requiredSize, m_buffer.size() * 2));
+
+		std::uint8_t* ptr = m_buffer.data() + m_size;
+		m_size += size;
+
+		return ptr;
+	}
+
+	BinaryReader::BinaryReader(std::span<const std::uint8_t> data) :
+	m_data(data),
+	m_stream(nullptr),
+	m_offset(0),
+	m_consumedSize(0)
+	{
+	}
+
+	BinaryReader::BinaryReader(std::istream& stream, std::size_t chunkSize) :
+	m_chunk(chunkSize),
+	m_stream(&stream),
+	m_offset(0),
+	m_consumedSize(0)
+	{
+	}
+
+	std::uint64_t BinaryReader::GetPosition() const
+	{
+		return m_consumedSize + m_offset;
+	}
+
+	std::size_t BinaryReader::GetRemainingSize() const
+	{
+		// En flux la taille restante n'est pas connue à l'avance : les lectures restent vérifiées bloc par bloc
+		if (m_stream)
+			return std::numeric_limits<std::size_t>::max();
+
+		return m_data.size() - m_offset;
+	}
+
+	bool BinaryReader::IsAtEnd()
+	{
+		return m_offset == m_data.size() && Refill() == 0;
+	}
+
+	void BinaryReader::ReadBytes(void* data, std::size_t size)
+	{
+		if (!m_stream && size > m_data.size() - m_offset)
+			throw std::runtime_error("unexpected end of binary data");
+
+		std::uint8_t* output = static_cast<std::uint8_t*>(data);
+		while (size > 0)
+		{
+			std::size_t availableSize = m_data.size() - m_offset;
+			if (availableSize == 0)
+			{
+				availableSize = Refill();
+				if (availableSize == 0)
+					throw std::runtime_error("unexpected end of binary data");
+			}
+
+			std::size_t copySize = std::min(availableSize, size);
+			std::memcpy(output, m_data.data() + m_offset, copySize);
+
+			m_offset += copySize;
+			output += copySize;
+			size -= copySize;
+		}
+	}
+
+	std::string BinaryReader::ReadString()
+	{
+		std::uint64_t length = ReadVarUInt();
+		if (!m_stream && length > m_data.size() - m_offset)
+			throw std::runtime_error("unexpected end of binary data");
+
+		// En flux la longueur n'est pas vérifiable à l'avance : on lit bloc par bloc pour ne pas allouer
+		// une chaîne démesurée à cause d'une longueur corrompue
+		std::string value;
+		while (value.size() < length)
+		{
+			std::size_t readSize = static_cast<std::size_t>(std::min<std::uint64_t>(length - value.size(), std::max<std::size_t>(m_chunk.size(), DefaultBinaryChunkSize)));
+
+			std::size_t offset = value.size();
+			value.resize(offset + readSize);
+			ReadBytes(&value[offset], readSize);
+		}
+
+		return value;
+	}
+
+	std::uint64_t BinaryReader::ReadVarUInt()
+	{
+		std::uint64_t value = 0;
+		for (unsigned int shift = 0; shift < 64; shift += 7)
+		{
+			std::uint8_t byte = Read<std::uint8_t>();
+			value |= std::uint64_t(byte & 0x7F) << shift;
+
+			if ((byte & 0x80) == 0)
+				return value;
+		}
+
+		throw std::runtime_error("invalid varint in binary data");
+	}
+
+	void BinaryReader::Skip(std::size_t size)
+	{
+		if (!m_stream && size > m_data.size() - m_offset)
+			throw std::runtime_error("unexpected end of binary data");
+
+		while (size > 0)
+		{
+			std::size_t availableSize = m_data.size() - m_offset;
+			if (availableSize == 0)
+			{
+				availableSize = Refill();
+				if (availableSize == 0)
+					throw std::runtime_error("unexpected end of binary data");
+			}
+
+			std::size_t skipSize = std::min(availableSize, size);
+			m_offset += skipSize;
+			size -= skipSize;
+		}
+	}
+
+	void BinaryReader::SkipPadding(std::size_t alignment)
+	{
+		Skip(static_cast<std::size_t>((alignment - GetPosition() % alignment) % alignment));
+	}
+
+	std::size_t BinaryReader::Refill()
+	{
+		if (!m_stream)
+			return 0;
+
+		m_consumedSize += m_offset;
+		m_offset = 0;
+
+		m_stream->read(reinterpret_cast<char*>(m_chunk.data()), static_cast<std::streamsize>(m_chunk.size()));
+		std::size_t readSize = static_cast<std::size_t>(m_stream->gcount());
+
+		m_data = std::span<const std::uint8_t>(m_chunk.data(), readSize);
+
+		return readSize;
+	}
+}
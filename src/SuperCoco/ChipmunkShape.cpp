@@ -96,7 +96,7 @@ namespace Sce
 		return ChipmunkShape(body, cpCircleShapeNew(body.GetHandle(), radius, cpv(offset.x, offset.y)));
 	}
 
-	ChipmunkShape ChipmunkShape::BuildConvexHull(ChipmunkBody& body, const std::vector<Vector2f>& positions, const Matrixf& transform, float radius)
+	ChipmunkShape ChipmunkShape::BuildConvexHull(ChipmunkBody& body, const std::vector<Vector2f>& positions, const Affine2f& transform, float radius)
 	{
 		std::vector<cpVect> verts;
 		verts.reserve(positions.size());
@@ -139,7 +139,7 @@ namespace Sce
 		return static_cast<float>(cpMomentForCircle(mass, 0.f, radius, cpv(offset.x, offset.y)));
 	}
 
-	float ChipmunkShape::ComputePolyMoment(float mass, const std::vector<Vector2f>& positions, const Matrixf& transform, float radius)
+	float ChipmunkShape::ComputePolyMoment(float mass, const std::vector<Vector2f>& positions, const Affine2f& transform, float radius)
 	{
 		std::vector<cpVect> verts;
 		verts.reserve(positions.size());
@@ -26,12 +26,12 @@ namespace Sce
 			cpSpaceFree(m_handle);
 	}
 
-	void ChipmunkSpace::DebugDraw(Renderer& renderer, const Matrixf& cameraInverseTransform)
+	void ChipmunkSpace::DebugDraw(Renderer& renderer, const Affine2f& cameraInverseTransform)
 	{
 		struct DrawData
 		{
 			Renderer& renderer;
-			const Matrixf& viewMatrix;
+			const Affine2f& viewMatrix;
 		};
 
 		DrawData drawData{ renderer, cameraInverseTransform };
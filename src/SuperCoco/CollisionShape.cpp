@@ -73,7 +73,7 @@ namespace Sce
 	{
 	}
 
-	ConvexShape::ConvexShape(const Model& model, Matrixf transformation, float radius_) :
+	ConvexShape::ConvexShape(const Model& model, const Affine2f& transformation, float radius_) :
 	radius(radius_)
 	{
 		const std::vector<ModelVertex>& vertices = model.GetVertices();
@@ -85,7 +85,7 @@ namespace Sce
 
 	ChipmunkShape ConvexShape::Build(ChipmunkBody& body, const Vector2f& offset) const
 	{
-		ChipmunkShape shape = ChipmunkShape::BuildConvexHull(body, positions, Matrixf::MakeFromPosition(offset));
+		ChipmunkShape shape = ChipmunkShape::BuildConvexHull(body, positions, Affine2f::MakeFromPosition(offset));
 		shape.SetFriction(friction);
 
 		return shape;
@@ -93,7 +93,7 @@ namespace Sce
 
 	float ConvexShape::ComputeMoment(float mass, const Vector2f& offset) const
 	{
-		return ChipmunkShape::ComputePolyMoment(mass, positions, Matrixf::MakeFromPosition(offset));
+		return ChipmunkShape::ComputePolyMoment(mass, positions, Affine2f::MakeFromPosition(offset));
 	}
 
 	//
@@ -15,6 +15,17 @@ namespace Sce
 		RegisterEngineComponents();
 	}
 
+	const ComponentRegistry::Entry* ComponentRegistry::FindComponent(const std::string& id) const
+	{
+		for (const auto& entry : m_componentTypes)
+		{
+			if (entry.id == id)
+				return &entry;
+		}
+
+		return nullptr;
+	}
+
 	void ComponentRegistry::ForEachComponent(const std::function<void(const Entry&)>& callback) const
 	{
 		for (const auto& entry : m_componentTypes)
@@ -39,7 +50,10 @@ namespace Sce
 			.removeComponent = BuildRemoveComponent<NameComponent>(),
 			.inspect = BuildInspect<NameComponent>(),
 			.serialize = BuildSerialize<NameComponent>(),
-			.unserialize = BuildUnserialize<NameComponent>()
+			.unserialize = BuildUnserialize<NameComponent>(),
+			.serializeColumn = BuildSerializeColumn<NameComponent>(),
+			.decodeColumn = BuildDecodeColumn<NameComponent>(),
+			.instantiate = BuildInstantiate<NameComponent>()
 		});
 		
 		Register({
@@ -49,7 +63,10 @@ namespace Sce
 			.hasComponent = BuildHasComponent<CameraComponent>(),
 			.removeComponent = BuildRemoveComponent<CameraComponent>(),
 			.serialize = BuildSerialize<CameraComponent>(),
-			.unserialize = BuildUnserialize<CameraComponent>()
+			.unserialize = BuildUnserialize<CameraComponent>(),
+			.serializeColumn = BuildSerializeColumn<CameraComponent>(),
+			.decodeColumn = BuildDecodeColumn<CameraComponent>(),
+			.instantiate = BuildInstantiate<CameraComponent>()
 		});
 		
 		Register({
@@ -60,7 +77,10 @@ namespace Sce
 			.removeComponent = BuildRemoveComponent<Transform>(),
 			.inspect = BuildInspect<Transform>(),
 			.serialize = BuildSerialize<Transform>(),
-			.unserialize = BuildUnserialize<Transform>()
+			.unserialize = BuildUnserialize<Transform>(),
+			.serializeColumn = BuildSerializeColumn<Transform>(),
+			.decodeColumn = BuildDecodeColumn<Transform>(),
+			.instantiate = BuildInstantiate<Transform>()
 		});
 
 		Register({
@@ -71,7 +91,10 @@ namespace Sce
 			.removeComponent = BuildRemoveComponent<VelocityComponent>(),
 			.inspect = BuildInspect<VelocityComponent>(),
 			.serialize = BuildSerialize<VelocityComponent>(),
-			.unserialize = BuildUnserialize<VelocityComponent>()
+			.unserialize = BuildUnserialize<VelocityComponent>(),
+			.serializeColumn = BuildSerializeColumn<VelocityComponent>(),
+			.decodeColumn = BuildDecodeColumn<VelocityComponent>(),
+			.instantiate = BuildInstantiate<VelocityComponent>()
 		});
 
 		Register({
@@ -80,9 +103,14 @@ namespace Sce
 			.addComponent = BuildAddComponent<GraphicsComponent>(),
 			.hasComponent = BuildHasComponent<GraphicsComponent>(),
 			.removeComponent = BuildRemoveComponent<GraphicsComponent>(),
-			.inspect = BuildInspect<GraphicsComponent>(),
+			// Le renderable peut être modifié depuis l'inspecteur (taille, layer...) : patch le signale au rendu et à l'index spatial
+			.inspect = [](WorldEditor& worldEditor, entt::handle entity)
+			{
+				entity.patch<GraphicsComponent>([&](GraphicsComponent& graphics) { graphics.PopulateInspector(worldEditor); });
+			},
 			.serialize = BuildSerialize<GraphicsComponent>(),
-			.unserialize = BuildUnserialize<GraphicsComponent>()
+			.unserialize = BuildUnserialize<GraphicsComponent>(),
+			.instantiate = &GraphicsComponent::Instantiate
 		});
 
 		Register({
@@ -92,7 +120,8 @@ namespace Sce
 			.removeComponent = BuildRemoveComponent<SpritesheetComponent>(),
 			.inspect = BuildInspect<SpritesheetComponent>(),
 			.serialize = BuildSerialize<SpritesheetComponent>(),
-			.unserialize = BuildUnserialize<SpritesheetComponent>()
+			.unserialize = BuildUnserialize<SpritesheetComponent>(),
+			.instantiate = &SpritesheetComponent::Instantiate
 		});
 
 		Register({
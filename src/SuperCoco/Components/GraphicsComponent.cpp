@@ -1,4 +1,5 @@
 #include <SuperCoco/Components/GraphicsComponent.hpp>
+#include <SuperCoco/Components/PendingModelComponent.hpp>
 #include <SuperCoco/Model.hpp>
 #include <SuperCoco/Sprite.hpp>
 #include <SuperCoco/Renderable.hpp>
@@ -35,12 +36,45 @@ namespace Sce
 	nlohmann::json GraphicsComponent::Serialize(const entt::handle entity) const
 	{
 		nlohmann::json doc;
-		if (m_renderable)
+		if (const PendingModelComponent* pendingModel = entity.try_get<PendingModelComponent>())
+		{
+			// Le renderable n'est encore que le modle "manquant", on garde le chemin du modle attendu
+			doc["Renderable"]["Type"] = "Model";
+			doc["Renderable"]["Path"] = pendingModel->modelPath;
+		}
+		else if (m_renderable)
 			doc["Renderable"] = m_renderable->Serialize();
 
 		return doc;
 	}
 
+	void GraphicsComponent::Instantiate(const entt::registry& prefabRegistry, entt::entity prototype, entt::registry& registry, std::span<const entt::entity> entities)
+	{
+		const GraphicsComponent& prototypeGraphics = prefabRegistry.get<GraphicsComponent>(prototype);
+		registry.insert<GraphicsComponent>(entities.begin(), entities.end(), prototypeGraphics);
+
+		// Le modle du prototype peut encore tre en cours de chargement : les instances reoivent le modle charg ou l'attendent  leur tour
+		if (const PendingModelComponent* pendingModel = prefabRegistry.try_get<PendingModelComponent>(prototype))
+		{
+			if (pendingModel->model.IsReady())
+			{
+				for (entt::entity entity : entities)
+					registry.get<GraphicsComponent>(entity).m_renderable = pendingModel->model.Get();
+			}
+			else
+				registry.insert<PendingModelComponent>(entities.begin(), entities.end(), *pendingModel);
+		}
+
+		// Un sprite porte l'tat de son entit (frame d'animation) : chaque instance reoit sa copie, qui partage la texture.
+		// Les autres renderables (modles) sont immuables et restent partags entre toutes les instances.
+		std::shared_ptr<Sprite> prototypeSprite = std::dynamic_pointer_cast<Sprite>(prototypeGraphics.m_renderable);
+		if (!prototypeSprite)
+			return;
+
+		for (entt::entity entity : entities)
+			registry.get<GraphicsComponent>(entity).m_renderable = std::make_shared<Sprite>(*prototypeSprite);
+	}
+
 	void GraphicsComponent::Unserialize(entt::handle entity, const nlohmann::json& doc)
 	{
 		auto& gfxComponent = entity.emplace<GraphicsComponent>();
@@ -53,7 +87,20 @@ namespace Sce
 			// Ce n'est pas trs scalable, on devrait faire une factory (une map entre un nom et une fonction instanciant le renderable)
 			std::string renderableType = renderableDoc["Type"];
 			if (renderableType == "Model")
-				gfxComponent.m_renderable = Model::Unserialize(renderableDoc);
+			{
+				// Un modle rfrenc par son chemin est charg en arrire-plan (le modle "manquant" est affich en attendant),
+				// l'AssetLoadingSystem le met en place une fois prt
+				std::string modelPath = renderableDoc.value("Path", "");
+				if (!modelPath.empty())
+				{
+					AssetHandle<Model> model = ResourceManager::Instance().LoadModelAsync(modelPath);
+					gfxComponent.m_renderable = model.Get();
+					if (!model.IsReady())
+						entity.emplace_or_replace<PendingModelComponent>(std::move(model), std::move(modelPath));
+				}
+				else
+					gfxComponent.m_renderable = Model::Unserialize(renderableDoc);
+			}
 			else if (renderableType == "Sprite")
 				gfxComponent.m_renderable = Sprite::Unserialize(renderableDoc);
 			else
@@ -1,4 +1,5 @@
 #include <SuperCoco/NameComponent.hpp>
+#include <SuperCoco/BinarySerializer.hpp>
 #include <imgui.h>
 #include <misc/cpp/imgui_stdlib.h> //< ImGui::InputText avec std::string
 #include <entt/entt.hpp>
@@ -24,8 +25,18 @@ namespace Sce
 		return doc;
 	}
 
+	void NameComponent::SerializeBinary(BinaryWriter& writer) const
+	{
+		writer.WriteString(name);
+	}
+
 	void NameComponent::Unserialize(entt::handle entity, const nlohmann::json& doc)
 	{
 		entity.emplace<NameComponent>(doc.value("Name", ""));
 	}
+
+	NameComponent NameComponent::UnserializeBinary(BinaryReader& reader)
+	{
+		return NameComponent(reader.ReadString());
+	}
 }
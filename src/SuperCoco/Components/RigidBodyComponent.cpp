@@ -129,6 +129,11 @@ namespace Sce
 		return m_body.GetHandle();
 	}
 
+	bool RigidBodyComponent::IsEnabled() const
+	{
+		return cpBodyGetSpace(m_body.GetHandle()) != nullptr;
+	}
+
 	void RigidBodyComponent::RemoveShape(const std::shared_ptr<CollisionShape>& shape, bool recomputeMoment)
 	{
 		std::size_t count = m_shapes.erase(shape);
@@ -146,6 +151,30 @@ namespace Sce
 		m_body.SetCenterOfGravity(centerOfGravity);
 	}
 
+	void RigidBodyComponent::SetEnabled(bool enabled)
+	{
+		if (enabled == IsEnabled())
+			return;
+
+		cpBody* body = m_body.GetHandle();
+		if (enabled)
+		{
+			cpSpace* space = PhysicsSystem::Instance()->GetSpace().GetHandle();
+			cpSpaceAddBody(space, body);
+			for (auto&& [shape, shapeData] : m_shapes)
+				cpSpaceAddShape(space, shapeData.physicsShape.GetHandle());
+		}
+		else
+		{
+			// Les shapes doivent quitter l'espace avant leur body
+			cpSpace* space = cpBodyGetSpace(body);
+			for (auto&& [shape, shapeData] : m_shapes)
+				cpSpaceRemoveShape(space, shapeData.physicsShape.GetHandle());
+
+			cpSpaceRemoveBody(space, body);
+		}
+	}
+
 	void RigidBodyComponent::SetLinearVelocity(const Vector2f& linearVelocity)
 	{
 		m_body.SetLinearVelocity(linearVelocity);
@@ -80,6 +80,22 @@ namespace Sce
 		return doc;
 	}
 
+	void SpritesheetComponent::Instantiate(const entt::registry& prefabRegistry, entt::entity prototype, entt::registry& registry, std::span<const entt::entity> entities)
+	{
+		// La spritesheet est partagée, le sprite animé est celui de l'instance (copié par GraphicsComponent::Instantiate)
+		const SpritesheetComponent& prototypeSpritesheet = prefabRegistry.get<SpritesheetComponent>(prototype);
+		registry.insert<SpritesheetComponent>(entities.begin(), entities.end(), prototypeSpritesheet);
+
+		for (entt::entity entity : entities)
+		{
+			SpritesheetComponent& spritesheet = registry.get<SpritesheetComponent>(entity);
+			if (const GraphicsComponent* gfxEntity = registry.try_get<GraphicsComponent>(entity))
+				spritesheet.m_targetSprite = std::dynamic_pointer_cast<Sprite>(gfxEntity->m_renderable);
+			else
+				spritesheet.m_targetSprite = nullptr;
+		}
+	}
+
 	void SpritesheetComponent::Unserialize(entt::handle entity, const nlohmann::json& doc)
 	{
 		GraphicsComponent* gfxEntity = entity.try_get<GraphicsComponent>();
@@ -1,7 +1,7 @@
 #include <SuperCoco/Components/TextComponent.hpp>
 #include <SuperCoco/ResourceManager.hpp>
 #include <SuperCoco/Renderer.hpp>
-#include <SuperCoco/Matrix.hpp>
+#include <SuperCoco/Affine2.hpp>
 #include <nlohmann/json.hpp>
 #include <imgui.h>
 #include <misc/cpp/imgui_stdlib.h>
@@ -13,75 +13,31 @@ namespace Sce
 	}
 
 	TextComponent::TextComponent(std::shared_ptr<Font> font, const std::string& txt, const SDL_Color& color) : m_font(font), m_text(txt), m_color(color)
-		, m_colorEditor(), m_sizeEditor(1), m_loadFail(false)
+		, m_origin(0.f, 0.f), m_isDirty(false), m_colorEditor(), m_sizeEditor(1), m_loadFail(false)
 	{
-		if (m_font && !m_text.empty())
-			m_texture = std::make_unique<Texture>(m_font->GenerateText(m_text, m_color));
+		UpdateMesh();
 	}
 
 	TextComponent::TextComponent(TextComponent&& textComponent)
 	{
-		m_texture = std::move(textComponent.m_texture);
+		m_mesh = std::move(textComponent.m_mesh);
 		m_font = std::move(textComponent.m_font);
 		m_color = textComponent.m_color;
 		m_text = textComponent.m_text;
 		m_origin = textComponent.m_origin;
 	}
 
-	void TextComponent::Render(Renderer& renderer, const Matrixf& transformMatrix) const
+	void TextComponent::Render(Renderer& renderer, const Affine2f& transformMatrix) const
 	{
-		SDL_Rect texRect{ 0, 0, 1, 1 };
-		if (m_texture)
-			texRect = m_texture->GetRect();
-
-		Vector2f originShift{ texRect.w * m_origin.x, texRect.h * m_origin.y };
-
-		Vector2f topLeft = transformMatrix * Vector2f(-originShift.x, -originShift.y);
-		Vector2f topRight = transformMatrix * Vector2f(texRect.w - originShift.x, -originShift.y);
-		Vector2f bottomLeft = transformMatrix * Vector2f(-originShift.x, texRect.h - originShift.y);
-		Vector2f bottomRight = transformMatrix * Vector2f(texRect.w - originShift.x, texRect.h - originShift.y);
-
-		float invWidth = 1.f / texRect.w;
-		float invHeight = 1.f / texRect.h;
-
-		SDL_Vertex vertices[4];
-		vertices[0].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[0].position = SDL_FPoint{ topLeft.x, topLeft.y };
-		vertices[0].tex_coord = SDL_FPoint{ 0.f, 0.f };
-
-		vertices[1].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[1].position = SDL_FPoint{ topRight.x, topRight.y };
-		vertices[1].tex_coord = SDL_FPoint{ texRect.w * invWidth, 0.f };
-
-		vertices[2].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[2].position = SDL_FPoint{ bottomLeft.x, bottomLeft.y };
-		vertices[2].tex_coord = SDL_FPoint{ 0.f, texRect.h * invHeight };
-
-		vertices[3].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[3].position = SDL_FPoint{ bottomRight.x, bottomRight.y };
-		vertices[3].tex_coord = SDL_FPoint{ texRect.w * invWidth, texRect.h * invHeight };
-
-		int indices[6] = { 0, 1, 2, 2, 1, 3 };
-
-		if (m_texture)
-			renderer.RenderGeometry(*m_texture.get(), vertices, 4, indices, 6);
-		else
-			renderer.RenderGeometry(vertices, 4, indices, 6);
+		m_mesh.Render(renderer, transformMatrix);
 	}
 
 	SDL_FRect TextComponent::GetBounds() const
 	{
-		if (!m_texture)
+		if (m_mesh.IsEmpty())
 			return SDL_FRect(0, 0, 20, 20);
 
-		SDL_Rect rect = m_texture->GetRect();
-		SDL_FRect bounds = {
-			0.f, 0.f, float(rect.w), float(rect.h)
-		};
-
-		bounds.x -= rect.w * m_origin.x;
-		bounds.y -= rect.h * m_origin.y;
-		return bounds;
+		return m_mesh.GetBounds();
 	}
 
 	int TextComponent::GetLayer() const
@@ -89,6 +45,11 @@ namespace Sce
 		return 10;
 	}
 
+	const Texture* TextComponent::GetTexture() const
+	{
+		return m_mesh.GetTexture();
+	}
+
 	nlohmann::json TextComponent::Serialize() const
 	{
 		/*document.SetObject();
@@ -131,24 +92,33 @@ namespace Sce
 	void TextComponent::SetText(const std::string& txt)
 	{
 		m_text = txt;
-		m_texture = std::make_unique<Texture>(m_font->GenerateText(m_text, m_color));
+		UpdateMesh();
 	}
 
 	void TextComponent::SetFont(const std::shared_ptr<Font> font)
 	{
 		m_font = font;
-		m_texture = std::make_unique<Texture>(m_font->GenerateText(m_text, m_color));
+		UpdateMesh();
 	}
 
 	void TextComponent::SetOrigine(const Vector2f& origine)
 	{
 		m_origin = origine;
+		UpdateMesh();
 	}
 
 	void TextComponent::SetColor(SDL_Color color)
 	{
 		m_color = color;
-		m_texture = std::make_unique<Texture>(m_font->GenerateText(m_text, m_color));
+		m_mesh.SetColor(m_color);
+	}
+
+	void TextComponent::UpdateMesh()
+	{
+		if (m_font && !m_text.empty())
+			m_mesh.Build(*m_font, m_text, m_color, m_origin);
+		else
+			m_mesh.Clear();
 	}
 
 	void TextComponent::PopulateInspector(WorldEditor& worldEditor)
@@ -187,7 +157,17 @@ namespace Sce
 
 		float originArray[2] = { m_origin.x, m_origin.y };
 		if (ImGui::InputFloat2("Origin", originArray))
+		{
 			m_origin = Vector2f{ originArray[0], originArray[1] };
+			m_isDirty = true;
+		}
+
+		// Les glyphes sont déjà dans l'atlas de la police, reconstruire les quads une fois par frame suffit
+		if (m_isDirty)
+		{
+			UpdateMesh();
+			m_isDirty = false;
+		}
 	}
 
 }
@@ -1,4 +1,5 @@
 #include <SuperCoco/Components/VelocityComponent.hpp>
+#include <SuperCoco/BinarySerializer.hpp>
 #include <SuperCoco/JsonSerializer.hpp>
 #include <SuperCoco/WorldEditor.hpp>
 #include <SuperCoco/Maths.hpp>
@@ -28,10 +29,25 @@ namespace Sce
 		return doc;
 	}
 
+	void VelocityComponent::SerializeBinary(BinaryWriter& writer) const
+	{
+		writer.Write(linearVel);
+		writer.Write(angularVel);
+	}
+
 	void VelocityComponent::Unserialize(entt::handle entity, const nlohmann::json& doc)
 	{
 		auto& vel = entity.emplace<VelocityComponent>();
 		vel.angularVel = doc.value("AngularVel", 0.f);
 		vel.linearVel = doc.value("LinearVel", Vector2f(0, 0));
 	}
+
+	VelocityComponent VelocityComponent::UnserializeBinary(BinaryReader& reader)
+	{
+		VelocityComponent vel;
+		vel.linearVel = reader.Read<Vector2f>();
+		vel.angularVel = reader.Read<float>();
+
+		return vel;
+	}
 }
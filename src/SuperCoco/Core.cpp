@@ -15,6 +15,7 @@
 #include <SuperCoco/Components/CameraComponent.hpp>
 #include <SuperCoco/Components/RigidBodyComponent.hpp>
 #include <SuperCoco/Components/TextComponent.hpp>
+#include <SuperCoco/Systems/SpatialSystem.hpp>
 #include <SuperCoco/CollisionShape.hpp>
 #include <fmt/core.h>
 
@@ -149,28 +150,19 @@ namespace Sce
 			return view.get<Transform>(entity);
 	}
 
-	entt::handle Core::GetHoveredEntity(entt::registry& registry, entt::handle camera)
+	entt::handle Core::GetHoveredEntity(entt::registry& registry, entt::handle camera, const SpatialSystem& spatialSystem)
 	{
 		Vector2i mousePos = GetMousePosition();
 		Vector2f relativePos(mousePos.x, mousePos.y);
 
 		auto& cameraTransform = camera.get<Transform>();
+		Vector2f worldPos = cameraTransform.LocalToWorldPoint(relativePos);
 
-		auto view = registry.view<Transform, GraphicsComponent>();
-		for (auto&& [entity, transform, gfx] : view.each())
-		{
-			Vector2f worldPos = cameraTransform.LocalToWorldPoint(relativePos);
-			Vector2f localPos = transform.WorldToLocalPoint(worldPos);
-
-			SDL_FRect bounds = gfx.m_renderable->GetBounds();
-			if (localPos.x >= bounds.x && localPos.y >= bounds.y &&
-				localPos.x < bounds.x + bounds.w && localPos.y < bounds.y + bounds.h)
-			{
-				return entt::handle(registry, entity);
-			}
-		}
+		entt::entity entity = spatialSystem.PickEntity(worldPos);
+		if (entity == entt::null)
+			return entt::handle{};
 
-		return entt::handle{};
+		return entt::handle(registry, entity);
 	}
 
 	Vector2i Core::GetMousePosition()
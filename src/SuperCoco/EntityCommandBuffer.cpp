@@ -0,0 +1,118 @@
+#include <SuperCoco/EntityCommandBuffer.hpp>
+#include <algorithm>
+
+namespace Sce
+{
+	namespace
+	{
+		std::atomic_uint64_t s_nextBufferId = 1;
+	}
+
+	EntityCommandBuffer::EntityCommandBuffer(entt::registry& registry) :
+	m_createdCount(0),
+	m_bufferId(s_nextBufferId++),
+	m_registry(registry)
+	{
+	}
+
+	EntityCommandBuffer::~EntityCommandBuffer() = default;
+
+	EntityCommandBuffer::DeferredEntity EntityCommandBuffer::Create()
+	{
+		return DeferredEntity{ m_createdCount++ };
+	}
+
+	void EntityCommandBuffer::Defer(std::function<void(entt::registry& registry)> func)
+	{
+		GetLocalCommands().deferredFunctions.push_back(std::move(func));
+	}
+
+	void EntityCommandBuffer::Destroy(entt::entity entity)
+	{
+		GetLocalCommands().destroyedEntities.push_back(entity);
+	}
+
+	void EntityCommandBuffer::Playback()
+	{
+		// Les commandes sont sorties des tableaux des threads avant d'être appliquées : une fonction différée
+		// peut ainsi enregistrer de nouvelles commandes, qui seront appliquées au Playback suivant
+		Commands commands;
+		{
+			std::lock_guard lock(m_mutex);
+			for (auto& threadCommands : m_threadCommands)
+				MergeCommands(commands, *threadCommands);
+		}
+
+		std::vector<entt::entity> createdEntities(m_createdCount.exchange(0));
+		m_registry.create(createdEntities.begin(), createdEntities.end());
+
+		for (auto&& [componentId, componentCommands] : commands.components)
+			componentCommands->PlaybackEmplace(m_registry, createdEntities);
+
+		for (auto& func : commands.deferredFunctions)
+			func(m_registry);
+
+		for (auto&& [componentId, componentCommands] : commands.components)
+			componentCommands->PlaybackRemove(m_registry, createdEntities);
+
+		// La destruction par plage refuse les entités invalides et les doublons (une entité tuée deux fois dans la même frame)
+		std::vector<entt::entity>& destroyedEntities = commands.destroyedEntities;
+		destroyedEntities.erase(std::remove_if(destroyedEntities.begin(), destroyedEntities.end(), [&](entt::entity entity) { return !m_registry.valid(entity); }), destroyedEntities.end());
+		std::sort(destroyedEntities.begin(), destroyedEntities.end());
+		destroyedEntities.erase(std::unique(destroyedEntities.begin(), destroyedEntities.end()), destroyedEntities.end());
+
+		m_registry.destroy(destroyedEntities.begin(), destroyedEntities.end());
+	}
+
+	EntityCommandBuffer::Commands& EntityCommandBuffer::GetLocalCommands()
+	{
+		// Chaque thread garde en cache les commandes du dernier buffer utilisé, le verrou n'est pris qu'au premier enregistrement
+		thread_local std::uint64_t t_bufferId = 0;
+		thread_local Commands* t_commands = nullptr;
+
+		if (t_bufferId == m_bufferId)
+			return *t_commands;
+
+		std::lock_guard lock(m_mutex);
+
+		std::thread::id threadId = std::this_thread::get_id();
+		auto it = std::find_if(m_threadCommands.begin(), m_threadCommands.end(), [&](const std::unique_ptr<Commands>& commands) { return commands->owner == threadId; });
+		if (it == m_threadCommands.end())
+		{
+			it = m_threadCommands.insert(m_threadCommands.end(), std::make_unique<Commands>());
+			(*it)->owner = threadId;
+		}
+
+		t_bufferId = m_bufferId;
+		t_commands = it->get();
+
+		return *t_commands;
+	}
+
+	void EntityCommandBuffer::MergeCommands(Commands& destination, Commands& source)
+	{
+		for (auto&& [componentId, componentCommands] : source.components)
+		{
+			std::unique_ptr<ComponentCommands>& destinationCommands = destination.components[componentId];
+			if (destinationCommands)
+				destinationCommands->Append(*componentCommands);
+			else
+				destinationCommands = std::move(componentCommands);
+		}
+		source.components.clear();
+
+		destination.destroyedEntities.insert(destination.destroyedEntities.end(), source.destroyedEntities.begin(), source.destroyedEntities.end());
+		source.destroyedEntities.clear();
+
+		destination.deferredFunctions.insert(destination.deferredFunctions.end(), std::make_move_iterator(source.deferredFunctions.begin()), std::make_move_iterator(source.deferredFunctions.end()));
+		source.deferredFunctions.clear();
+	}
+
+	entt::entity EntityCommandBuffer::Target::Resolve(const std::vector<entt::entity>& createdEntities) const
+	{
+		if (deferredIndex == NotDeferred)
+			return entity;
+
+		return createdEntities[deferredIndex];
+	}
+}
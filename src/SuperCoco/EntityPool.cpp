@@ -0,0 +1,174 @@
+#include <SuperCoco/EntityPool.hpp>
+#include <SuperCoco/Components/PoolComponents.hpp>
+#include <SuperCoco/Components/RigidBodyComponent.hpp>
+#include <algorithm>
+
+namespace Sce
+{
+	float EntityPool::Stats::GetHitRate() const
+	{
+		if (acquireCount == 0)
+			return 0.f;
+
+		return static_cast<float>(hitCount) / static_cast<float>(acquireCount);
+	}
+
+	EntityPool::EntityPool(entt::registry& registry, CreateCallback create, ResetCallback reset, std::size_t maxPooledCount) :
+	m_create(std::move(create)),
+	m_reset(std::move(reset)),
+	m_registry(registry),
+	m_maxPooledCount(maxPooledCount)
+	{
+	}
+
+	EntityPool::~EntityPool()
+	{
+		Clear();
+
+		// Les entités encore actives survivent au pool : elles seront détruites normalement à leur mort
+		std::vector<entt::entity> activeEntities;
+		for (auto&& [entity, pooled] : m_registry.view<PooledComponent>().each())
+		{
+			if (pooled.pool == this)
+				activeEntities.push_back(entity);
+		}
+
+		m_registry.remove<PooledComponent>(activeEntities.begin(), activeEntities.end());
+	}
+
+	entt::handle EntityPool::Acquire()
+	{
+		entt::entity entity;
+		Acquire(std::span<entt::entity>(&entity, 1));
+
+		return entt::handle{ m_registry, entity };
+	}
+
+	void EntityPool::Acquire(std::span<entt::entity> entities)
+	{
+		std::size_t hitCount = std::min(entities.size(), m_inactiveEntities.size());
+		for (std::size_t i = 0; i < hitCount; ++i)
+		{
+			entt::entity entity = m_inactiveEntities.back();
+			m_inactiveEntities.pop_back();
+
+			Activate(entity);
+			if (m_reset)
+				m_reset(entt::handle{ m_registry, entity });
+
+			entities[i] = entity;
+		}
+
+		Create(entities.subspan(hitCount));
+
+		m_stats.acquireCount += entities.size();
+		m_stats.hitCount += hitCount;
+		m_stats.pooledCount = m_inactiveEntities.size();
+	}
+
+	void EntityPool::Clear()
+	{
+		m_registry.destroy(m_inactiveEntities.begin(), m_inactiveEntities.end());
+		m_inactiveEntities.clear();
+		m_stats.pooledCount = 0;
+	}
+
+	const EntityPool::Stats& EntityPool::GetStats() const
+	{
+		return m_stats;
+	}
+
+	std::uint32_t EntityPool::GetGeneration(const entt::registry& registry, entt::entity entity)
+	{
+		const PooledComponent* pooled = registry.try_get<PooledComponent>(entity);
+		return (pooled) ? pooled->generation : 0;
+	}
+
+	bool EntityPool::IsAlive(const entt::registry& registry, entt::entity entity, std::uint32_t generation)
+	{
+		if (!registry.valid(entity) || registry.all_of<InactiveComponent>(entity))
+			return false;
+
+		return GetGeneration(registry, entity) == generation;
+	}
+
+	void EntityPool::Release(entt::entity entity)
+	{
+		// Une entité peut mourir deux fois dans la même frame (deux collisions), on ne la range qu'une fois
+		if (!m_registry.valid(entity) || m_registry.all_of<InactiveComponent>(entity))
+			return;
+
+		m_stats.releaseCount++;
+
+		// Ce qui a capturé l'entité pendant sa vie précédente ne doit plus la reconnaître une fois recyclée
+		if (PooledComponent* pooled = m_registry.try_get<PooledComponent>(entity))
+			pooled->generation++;
+
+		if (m_inactiveEntities.size() >= m_maxPooledCount)
+		{
+			m_registry.destroy(entity);
+			return;
+		}
+
+		Deactivate(entity);
+		m_inactiveEntities.push_back(entity);
+		m_stats.pooledCount = m_inactiveEntities.size();
+	}
+
+	void EntityPool::Reserve(std::size_t count)
+	{
+		count = std::min(count, m_maxPooledCount);
+		if (count <= m_inactiveEntities.size())
+			return;
+
+		std::vector<entt::entity> entities(count - m_inactiveEntities.size());
+		Create(entities);
+
+		for (entt::entity entity : entities)
+			Deactivate(entity);
+
+		m_inactiveEntities.insert(m_inactiveEntities.end(), entities.begin(), entities.end());
+		m_stats.pooledCount = m_inactiveEntities.size();
+	}
+
+	void EntityPool::ResetStats()
+	{
+		m_stats = Stats{};
+		m_stats.pooledCount = m_inactiveEntities.size();
+	}
+
+	void EntityPool::Activate(entt::entity entity)
+	{
+		InactiveComponent& inactive = m_registry.get<InactiveComponent>(entity);
+		if (inactive.graphics)
+			m_registry.emplace<GraphicsComponent>(entity, std::move(*inactive.graphics));
+
+		if (RigidBodyComponent* rigidBody = m_registry.try_get<RigidBodyComponent>(entity))
+			rigidBody->SetEnabled(true);
+
+		m_registry.remove<InactiveComponent>(entity);
+	}
+
+	void EntityPool::Create(std::span<entt::entity> entities)
+	{
+		if (entities.empty())
+			return;
+
+		m_create(m_registry, entities);
+		m_registry.insert<PooledComponent>(entities.begin(), entities.end(), PooledComponent{ this });
+	}
+
+	void EntityPool::Deactivate(entt::entity entity)
+	{
+		// Le corps et ses shapes sortent de l'espace mais restent construits, ils y seront remis tels quels
+		if (RigidBodyComponent* rigidBody = m_registry.try_get<RigidBodyComponent>(entity))
+			rigidBody->SetEnabled(false);
+
+		InactiveComponent& inactive = m_registry.emplace<InactiveComponent>(entity);
+		if (GraphicsComponent* graphics = m_registry.try_get<GraphicsComponent>(entity))
+		{
+			inactive.graphics = std::move(*graphics);
+			m_registry.remove<GraphicsComponent>(entity);
+		}
+	}
+}
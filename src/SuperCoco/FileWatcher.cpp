@@ -0,0 +1,174 @@
+#include <SuperCoco/FileWatcher.hpp>
+#include <algorithm>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace Sce
+{
+	namespace
+	{
+		std::filesystem::path NormalizePath(const std::string& filepath)
+		{
+			std::error_code ec;
+			std::filesystem::path absolutePath = std::filesystem::absolute(filepath, ec);
+			if (ec)
+				absolutePath = filepath;
+
+			return absolutePath.lexically_normal();
+		}
+
+		std::filesystem::file_time_type GetLastWriteTime(const std::filesystem::path& path)
+		{
+			std::error_code ec;
+			std::filesystem::file_time_type lastWriteTime = std::filesystem::last_write_time(path, ec);
+			if (ec)
+				return std::filesystem::file_time_type::min();
+
+			return lastWriteTime;
+		}
+	}
+
+	FileWatcher::FileWatcher(float pollInterval) :
+	m_pollInterval(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(pollInterval))),
+	m_nextPoll(std::chrono::steady_clock::now()),
+	m_inotifyFd(-1)
+	{
+#ifdef __linux__
+		m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+	}
+
+	FileWatcher::~FileWatcher()
+	{
+#ifdef __linux__
+		if (m_inotifyFd >= 0)
+			close(m_inotifyFd);
+#endif
+	}
+
+	bool FileWatcher::IsUsingNativeNotifications() const
+	{
+		return m_inotifyFd >= 0;
+	}
+
+	std::vector<std::string> FileWatcher::Poll()
+	{
+		std::unordered_set<std::string> changedFiles;
+		if (IsUsingNativeNotifications())
+			PollNativeNotifications(changedFiles);
+		else
+			PollModificationTimes(changedFiles);
+
+		return std::vector<std::string>(changedFiles.begin(), changedFiles.end());
+	}
+
+	void FileWatcher::Unwatch(const std::string& filepath)
+	{
+		auto it = m_files.find(filepath);
+		if (it == m_files.end())
+			return;
+
+		// Le watch inotify du dossier est conservé : d'autres fichiers du même dossier sont probablement surveillés
+		auto byPathIt = m_filesByNormalizedPath.find(it->second.normalizedPath.string());
+		if (byPathIt != m_filesByNormalizedPath.end())
+		{
+			std::erase(byPathIt->second, filepath);
+			if (byPathIt->second.empty())
+				m_filesByNormalizedPath.erase(byPathIt);
+		}
+
+		m_files.erase(it);
+	}
+
+	void FileWatcher::Watch(const std::string& filepath)
+	{
+		if (m_files.contains(filepath))
+			return;
+
+		std::filesystem::path normalizedPath = NormalizePath(filepath);
+
+		WatchedFile& watchedFile = m_files[filepath];
+		watchedFile.normalizedPath = normalizedPath;
+		watchedFile.lastWriteTime = GetLastWriteTime(normalizedPath);
+
+		m_filesByNormalizedPath[normalizedPath.string()].push_back(filepath);
+
+#ifdef __linux__
+		if (m_inotifyFd >= 0)
+		{
+			// On surveille le dossier plutôt que le fichier : la plupart des éditeurs remplacent le fichier
+			// lors de la sauvegarde (écriture dans un fichier temporaire puis renommage), ce qui invaliderait un watch par fichier
+			std::filesystem::path directory = normalizedPath.parent_path();
+			if (!m_watchesByDirectory.contains(directory.string()))
+			{
+				int watchDescriptor = inotify_add_watch(m_inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+				if (watchDescriptor >= 0)
+				{
+					m_watchesByDirectory.emplace(directory.string(), watchDescriptor);
+					m_directoriesByWatch.emplace(watchDescriptor, directory);
+				}
+			}
+		}
+#endif
+	}
+
+	void FileWatcher::PollModificationTimes(std::unordered_set<std::string>& changedFiles)
+	{
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if (now < m_nextPoll)
+			return;
+
+		m_nextPoll = now + m_pollInterval;
+
+		for (auto& [filepath, watchedFile] : m_files)
+		{
+			std::filesystem::file_time_type lastWriteTime = GetLastWriteTime(watchedFile.normalizedPath);
+			if (lastWriteTime != watchedFile.lastWriteTime)
+			{
+				watchedFile.lastWriteTime = lastWriteTime;
+
+				// Un fichier supprimé (ou en cours de remplacement) n'est pas signalé, il le sera à sa réapparition
+				if (lastWriteTime != std::filesystem::file_time_type::min())
+					changedFiles.insert(filepath);
+			}
+		}
+	}
+
+	void FileWatcher::PollNativeNotifications(std::unordered_set<std::string>& changedFiles)
+	{
+#ifdef __linux__
+		alignas(inotify_event) char buffer[4096];
+		for (;;)
+		{
+			ssize_t length = read(m_inotifyFd, buffer, sizeof(buffer));
+			if (length <= 0)
+				break; //< EAGAIN : plus aucun événement en attente
+
+			for (char* ptr = buffer; ptr < buffer + length;)
+			{
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(ptr);
+				ptr += sizeof(inotify_event) + event->len;
+
+				if (event->len == 0)
+					continue;
+
+				auto directoryIt = m_directoriesByWatch.find(event->wd);
+				if (directoryIt == m_directoriesByWatch.end())
+					continue;
+
+				std::filesystem::path changedPath = directoryIt->second / event->name;
+				auto it = m_filesByNormalizedPath.find(changedPath.string());
+				if (it == m_filesByNormalizedPath.end())
+					continue;
+
+				for (const std::string& filepath : it->second)
+					changedFiles.insert(filepath);
+			}
+		}
+#endif
+	}
+}
@@ -3,10 +3,16 @@
 #include <SuperCoco/Texture.hpp>
 #include <SuperCoco/Surface.hpp>
 #include <SDL2/SDL_ttf.h>
+#include <algorithm>
+#include <optional>
 #include <stdexcept>
 
 namespace Sce
 {
+	// Une page suffit généralement pour tous les glyphes utilisés par une police à une taille donnée
+	constexpr int GlyphPageSize = 512;
+	constexpr int GlyphPadding = 1;
+
 	Font::Font(Renderer* renderer, TTF_Font* font, int size, const std::string& assetName) :
 		m_renderer(renderer),
 		m_font(font),
@@ -18,11 +24,14 @@ namespace Sce
 
 	Font::~Font()
 	{
-		TTF_CloseFont(m_font);
+		if (m_font)
+			TTF_CloseFont(m_font);
 	}
 
 	Font::Font(Font&& font) noexcept
 	{
+		m_glyphs = std::move(font.m_glyphs);
+		m_glyphPages = std::move(font.m_glyphPages);
 		m_renderer = std::move(font.m_renderer);
 		m_font = font.m_font;
 		m_size = font.m_size;
@@ -34,6 +43,9 @@ namespace Sce
 	{
 		m_size = font.m_size;
 		m_assetName = font.m_assetName;
+		m_renderer = font.m_renderer;
+		std::swap(m_glyphs, font.m_glyphs);
+		std::swap(m_glyphPages, font.m_glyphPages);
 		std::swap(m_font, font.m_font);
 
 		return *this;
@@ -49,6 +61,97 @@ namespace Sce
 		return m_assetName;
 	}
 
+	const Font::Glyph& Font::GetGlyph(std::uint32_t codepoint)
+	{
+		auto it = m_glyphs.find(codepoint);
+		if (it != m_glyphs.end())
+			return it->second;
+
+		Glyph glyph{ SDL_Rect{ 0, 0, 0, 0 }, 0, 0 };
+
+		int minX, maxX, minY, maxY;
+		if (TTF_GlyphMetrics32(m_font, codepoint, &minX, &maxX, &minY, &maxY, &glyph.advance) != 0)
+			glyph.advance = 0;
+
+		// Les glyphes sans pixels (espaces) n'occupent pas de place dans l'atlas mais conservent leur avance
+		std::optional<Surface> surface;
+		try
+		{
+			surface.emplace(Surface::CreateTTFGlyphSurface(m_font, codepoint, SDL_Color{ 255, 255, 255, 255 }).ConvertToRGBA32());
+		}
+		catch (const std::exception&)
+		{
+		}
+
+		if (surface && surface->GetWidth() > 0 && surface->GetHeight() > 0)
+		{
+			int width = surface->GetWidth();
+			int height = surface->GetHeight();
+
+			std::optional<SDL_Rect> rect;
+			std::size_t pageIndex = 0;
+			for (; pageIndex < m_glyphPages.size(); ++pageIndex)
+			{
+				rect = m_glyphPages[pageIndex].packer.Insert(width + GlyphPadding, height + GlyphPadding);
+				if (rect)
+					break;
+			}
+
+			if (!rect)
+			{
+				int pageSize = std::max({ GlyphPageSize, width + GlyphPadding, height + GlyphPadding });
+
+				GlyphPage& page = m_glyphPages.emplace_back(GlyphPage{
+					std::make_shared<Texture>(Texture::Create(*m_renderer, pageSize, pageSize)),
+					SkylinePacker(pageSize, pageSize)
+				});
+
+				// Les pixels laissés libres par le padding doivent être transparents
+				Surface clearSurface = Surface::Create(pageSize, pageSize);
+				clearSurface.FillRect(SDL_Rect{ 0, 0, pageSize, pageSize }, 0, 0, 0, 0);
+				page.texture->Update(clearSurface, SDL_Rect{ 0, 0, pageSize, pageSize });
+
+				rect = page.packer.Insert(width + GlyphPadding, height + GlyphPadding);
+			}
+
+			glyph.rect = SDL_Rect{ rect->x, rect->y, width, height };
+			glyph.pageIndex = pageIndex;
+
+			m_glyphPages[pageIndex].texture->Update(*surface, glyph.rect);
+		}
+
+		return m_glyphs.emplace(codepoint, glyph).first->second;
+	}
+
+	const std::shared_ptr<Texture>& Font::GetGlyphPage(std::size_t pageIndex) const
+	{
+		return m_glyphPages[pageIndex].texture;
+	}
+
+	int Font::GetKerning(std::uint32_t previousCodepoint, std::uint32_t codepoint) const
+	{
+		return TTF_GetFontKerningSizeGlyphs32(m_font, previousCodepoint, codepoint);
+	}
+
+	int Font::GetLineHeight() const
+	{
+		return TTF_FontHeight(m_font);
+	}
+
+	int Font::GetLineSkip() const
+	{
+		return TTF_FontLineSkip(m_font);
+	}
+
+	std::size_t Font::GetMemorySize() const
+	{
+		std::size_t memorySize = m_glyphs.size() * sizeof(Glyph);
+		for (const GlyphPage& page : m_glyphPages)
+			memorySize += page.texture->GetMemorySize();
+
+		return memorySize;
+	}
+
 	Texture Font::GenerateText(std::string text, SDL_Color color) const
 	{
 		return Texture::CreateFromSurface(*m_renderer, Surface::CreateTTFSurface(m_font, text, color));
@@ -63,4 +166,17 @@ namespace Sce
 
 		return Font(&renderer, font, size, path);
 	}
+
+	Font Font::OpenFontFromMemory(Renderer& renderer, const std::string& assetName, const void* data, std::size_t dataSize, int size)
+	{
+		SDL_RWops* rw = SDL_RWFromConstMem(data, static_cast<int>(dataSize));
+		if (!rw)
+			throw std::runtime_error("Failed to open font");
+
+		TTF_Font* font = TTF_OpenFontRW(rw, 1, size);
+		if (!font)
+			throw std::runtime_error("Failed to open font");
+
+		return Font(&renderer, font, size, assetName);
+	}
 }
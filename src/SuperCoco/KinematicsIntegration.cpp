@@ -0,0 +1,137 @@
+#include <SuperCoco/KinematicsIntegration.hpp>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define SCE_KINEMATICS_X86
+	#include <immintrin.h>
+
+	#ifdef _MSC_VER
+		#define SCE_TARGET_AVX2
+	#else
+		#define SCE_TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#endif
+
+namespace Sce
+{
+	namespace
+	{
+		// Décale toutes les colonnes de offset entités
+		KinematicsColumns Offset(const KinematicsColumns& columns, std::size_t offset)
+		{
+			return KinematicsColumns{
+				columns.positionX + offset,
+				columns.positionY + offset,
+				columns.velocityX + offset,
+				columns.velocityY + offset,
+				columns.accelerationX + offset,
+				columns.accelerationY + offset
+			};
+		}
+
+		void IntegrateKinematicsScalar(const KinematicsColumns& columns, std::size_t count, const KinematicsSettings& settings)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				columns.velocityX[i] += columns.accelerationX[i] * settings.deltaTime;
+				columns.velocityY[i] += (columns.accelerationY[i] + settings.gravity) * settings.deltaTime;
+				columns.positionX[i] += columns.velocityX[i] * settings.deltaTime;
+				columns.positionY[i] += columns.velocityY[i] * settings.deltaTime;
+
+				if (columns.positionY[i] > settings.groundHeight)
+				{
+					columns.positionY[i] = settings.groundHeight;
+					columns.velocityY[i] = 0.f;
+				}
+			}
+		}
+
+#ifdef SCE_KINEMATICS_X86
+		// Quatre entités par registre, le test du sol devient un masque (pas de branche) :
+		// p.y = min(p.y, sol) et v.y est mise à zéro là où p.y dépassait le sol
+		void IntegrateKinematicsSSE2(const KinematicsColumns& columns, std::size_t count, const KinematicsSettings& settings)
+		{
+			const __m128 deltaTime = _mm_set1_ps(settings.deltaTime);
+			const __m128 gravity = _mm_set1_ps(settings.gravity);
+			const __m128 groundHeight = _mm_set1_ps(settings.groundHeight);
+
+			std::size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 velocityX = _mm_add_ps(_mm_loadu_ps(columns.velocityX + i), _mm_mul_ps(_mm_loadu_ps(columns.accelerationX + i), deltaTime));
+				__m128 velocityY = _mm_add_ps(_mm_loadu_ps(columns.velocityY + i), _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(columns.accelerationY + i), gravity), deltaTime));
+				__m128 positionX = _mm_add_ps(_mm_loadu_ps(columns.positionX + i), _mm_mul_ps(velocityX, deltaTime));
+				__m128 positionY = _mm_add_ps(_mm_loadu_ps(columns.positionY + i), _mm_mul_ps(velocityY, deltaTime));
+
+				__m128 belowGround = _mm_cmpgt_ps(positionY, groundHeight);
+				positionY = _mm_min_ps(positionY, groundHeight);
+				velocityY = _mm_andnot_ps(belowGround, velocityY);
+
+				_mm_storeu_ps(columns.velocityX + i, velocityX);
+				_mm_storeu_ps(columns.velocityY + i, velocityY);
+				_mm_storeu_ps(columns.positionX + i, positionX);
+				_mm_storeu_ps(columns.positionY + i, positionY);
+			}
+
+			IntegrateKinematicsScalar(Offset(columns, i), count - i, settings);
+		}
+
+		// Même principe que la version SSE2 avec huit entités par registre
+		SCE_TARGET_AVX2 void IntegrateKinematicsAVX2(const KinematicsColumns& columns, std::size_t count, const KinematicsSettings& settings)
+		{
+			const __m256 deltaTime = _mm256_set1_ps(settings.deltaTime);
+			const __m256 gravity = _mm256_set1_ps(settings.gravity);
+			const __m256 groundHeight = _mm256_set1_ps(settings.groundHeight);
+
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 velocityX = _mm256_add_ps(_mm256_loadu_ps(columns.velocityX + i), _mm256_mul_ps(_mm256_loadu_ps(columns.accelerationX + i), deltaTime));
+				__m256 velocityY = _mm256_add_ps(_mm256_loadu_ps(columns.velocityY + i), _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(columns.accelerationY + i), gravity), deltaTime));
+				__m256 positionX = _mm256_add_ps(_mm256_loadu_ps(columns.positionX + i), _mm256_mul_ps(velocityX, deltaTime));
+				__m256 positionY = _mm256_add_ps(_mm256_loadu_ps(columns.positionY + i), _mm256_mul_ps(velocityY, deltaTime));
+
+				__m256 belowGround = _mm256_cmp_ps(positionY, groundHeight, _CMP_GT_OQ);
+				positionY = _mm256_min_ps(positionY, groundHeight);
+				velocityY = _mm256_andnot_ps(belowGround, velocityY);
+
+				_mm256_storeu_ps(columns.velocityX + i, velocityX);
+				_mm256_storeu_ps(columns.velocityY + i, velocityY);
+				_mm256_storeu_ps(columns.positionX + i, positionX);
+				_mm256_storeu_ps(columns.positionY + i, positionY);
+			}
+
+			IntegrateKinematicsSSE2(Offset(columns, i), count - i, settings);
+		}
+#endif
+	}
+
+	void IntegrateKinematics(const KinematicsColumns& columns, std::size_t count, const KinematicsSettings& settings)
+	{
+		static const SimdLevel s_simdLevel = GetSupportedSimdLevel();
+		IntegrateKinematics(s_simdLevel, columns, count, settings);
+	}
+
+	void IntegrateKinematics(SimdLevel level, const KinematicsColumns& columns, std::size_t count, const KinematicsSettings& settings)
+	{
+		static const SimdLevel s_supportedLevel = GetSupportedSimdLevel();
+		if (level > s_supportedLevel)
+			level = s_supportedLevel;
+
+		switch (level)
+		{
+#ifdef SCE_KINEMATICS_X86
+			case SimdLevel::AVX2:
+				IntegrateKinematicsAVX2(columns, count, settings);
+				return;
+
+			case SimdLevel::SSE2:
+				IntegrateKinematicsSSE2(columns, count, settings);
+				return;
+#endif
+
+			default:
+				IntegrateKinematicsScalar(columns, count, settings);
+				return;
+		}
+	}
+}
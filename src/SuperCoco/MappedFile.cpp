@@ -0,0 +1,142 @@
+#include <SuperCoco/MappedFile.hpp>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Sce
+{
+	MappedFile::MappedFile() :
+	m_data(nullptr),
+	m_size(0)
+#ifdef _WIN32
+	, m_fileHandle(nullptr),
+	m_mappingHandle(nullptr)
+#endif
+	{
+	}
+
+	MappedFile::MappedFile(MappedFile&& mappedFile) noexcept :
+	MappedFile()
+	{
+		*this = std::move(mappedFile);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	std::span<const std::uint8_t> MappedFile::GetData() const
+	{
+		return std::span<const std::uint8_t>(m_data, m_size);
+	}
+
+	std::size_t MappedFile::GetSize() const
+	{
+		return m_size;
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& mappedFile) noexcept
+	{
+		std::swap(m_data, mappedFile.m_data);
+		std::swap(m_size, mappedFile.m_size);
+#ifdef _WIN32
+		std::swap(m_fileHandle, mappedFile.m_fileHandle);
+		std::swap(m_mappingHandle, mappedFile.m_mappingHandle);
+#endif
+
+		return *this;
+	}
+
+	void MappedFile::Close()
+	{
+#ifdef _WIN32
+		if (m_data)
+			UnmapViewOfFile(m_data);
+
+		if (m_mappingHandle)
+			CloseHandle(m_mappingHandle);
+
+		if (m_fileHandle)
+			CloseHandle(m_fileHandle);
+
+		m_fileHandle = nullptr;
+		m_mappingHandle = nullptr;
+#else
+		if (m_data)
+			munmap(const_cast<std::uint8_t*>(m_data), m_size);
+#endif
+
+		m_data = nullptr;
+		m_size = 0;
+	}
+
+	MappedFile MappedFile::Open(const std::string& filepath)
+	{
+		MappedFile mappedFile;
+
+#ifdef _WIN32
+		HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			throw std::runtime_error("couldn't open file " + filepath);
+
+		mappedFile.m_fileHandle = file;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize))
+			throw std::runtime_error("couldn't get size of " + filepath);
+
+		mappedFile.m_size = static_cast<std::size_t>(fileSize.QuadPart);
+		if (mappedFile.m_size == 0)
+			return mappedFile; //< impossible de projeter un fichier vide
+
+		mappedFile.m_mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mappedFile.m_mappingHandle)
+			throw std::runtime_error("couldn't map file " + filepath);
+
+		mappedFile.m_data = static_cast<const std::uint8_t*>(MapViewOfFile(mappedFile.m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+		if (!mappedFile.m_data)
+			throw std::runtime_error("couldn't map file " + filepath);
+#else
+		int fd = open(filepath.c_str(), O_RDONLY);
+		if (fd < 0)
+			throw std::runtime_error("couldn't open file " + filepath);
+
+		struct stat fileStat;
+		if (fstat(fd, &fileStat) != 0)
+		{
+			close(fd);
+			throw std::runtime_error("couldn't get size of " + filepath);
+		}
+
+		mappedFile.m_size = static_cast<std::size_t>(fileStat.st_size);
+		if (mappedFile.m_size == 0)
+		{
+			close(fd);
+			return mappedFile; //< impossible de projeter un fichier vide
+		}
+
+		void* data = mmap(nullptr, mappedFile.m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd); //< la projection garde sa propre référence sur le fichier
+		if (data == MAP_FAILED)
+		{
+			mappedFile.m_size = 0;
+			throw std::runtime_error("couldn't map file " + filepath);
+		}
+
+		mappedFile.m_data = static_cast<const std::uint8_t*>(data);
+#endif
+
+		return mappedFile;
+	}
+}
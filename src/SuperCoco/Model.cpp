@@ -1,16 +1,22 @@
 #include <SuperCoco/Model.hpp>
 #include <SuperCoco/Texture.hpp>
-#include <SuperCoco/Matrix.hpp>
+#include <SuperCoco/Affine2.hpp>
 #include <SuperCoco/JsonSerializer.hpp>
 #include <SuperCoco/BinarySerializer.hpp>
 #include <SuperCoco/ResourceManager.hpp>
+#include <SuperCoco/RenderCache.hpp>
 #include <SuperCoco/Renderer.hpp>
+#include <SuperCoco/VertexTransform.hpp>
 #include <fmt/color.h>
 #include <fmt/core.h>
 #include <fmt/std.h>
 #include <imgui.h>
 #include <lz4.h>
 #include <nlohmann/json.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <fstream>
 #include <cassert>
 
@@ -18,8 +24,76 @@ namespace Sce
 {
 	constexpr unsigned int FileVersion = 1;
 
+	// Format binaire (.bmodel) v2 :
+	// | BinaryModelHeader | chemin de la texture | vertices (SDL_Vertex) | indices (int32) |
+	// chaque bloc commence sur un multiple de 16 octets, les blocs peuvent tre compresss ensemble en LZ4
+	constexpr std::array<char, 4> BinaryModelMagic = { 'S', 'C', 'B', 'M' };
+	constexpr std::uint16_t BinaryModelVersion = 2;
+	constexpr std::size_t BinaryModelAlignment = 16;
+
+	enum BinaryModelFlags : std::uint8_t
+	{
+		BinaryModelFlag_LZ4 = 1 << 0
+	};
+
+	struct BinaryModelHeader
+	{
+		char magic[4];
+		std::uint16_t version;
+		std::uint8_t isBigEndian;
+		std::uint8_t flags;
+		std::uint32_t texturePathSize;
+		std::uint32_t vertexCount;
+		std::uint32_t indexCount;
+		std::uint32_t payloadSize; //< taille des blocs une fois dcompresss
+		std::uint32_t storedPayloadSize; //< taille des blocs dans le fichier
+		std::uint32_t reserved;
+	};
+
+	static_assert(sizeof(BinaryModelHeader) % BinaryModelAlignment == 0);
+	static_assert(sizeof(SDL_Vertex) == 5 * sizeof(float), "SDL_Vertex is stored as is in binary models");
+
+	namespace
+	{
+		std::size_t AlignBinaryModelOffset(std::size_t offset)
+		{
+			return (offset + BinaryModelAlignment - 1) / BinaryModelAlignment * BinaryModelAlignment;
+		}
+
+		std::size_t ComputeBinaryModelPayloadSize(std::size_t texturePathSize, std::size_t vertexCount, std::size_t indexCount)
+		{
+			std::size_t vertexOffset = AlignBinaryModelOffset(texturePathSize);
+			std::size_t indexOffset = AlignBinaryModelOffset(vertexOffset + vertexCount * sizeof(SDL_Vertex));
+
+			return indexOffset + indexCount * sizeof(std::int32_t);
+		}
+
+		template<typename T>
+		T ByteSwap(T value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			std::array<std::uint8_t, sizeof(T)> bytes;
+			std::memcpy(bytes.data(), &value, sizeof(T));
+			std::reverse(bytes.begin(), bytes.end());
+			std::memcpy(&value, bytes.data(), sizeof(T));
+
+			return value;
+		}
+
+		constexpr bool IsNativeBigEndian = (std::endian::native == std::endian::big);
+
+		// Les modles peuvent tre construits sur les threads de chargement du ResourceManager
+		std::uint64_t NextModelRevision()
+		{
+			static std::atomic<std::uint64_t> s_nextRevision = 1;
+			return s_nextRevision++;
+		}
+	}
+
 	Model::Model() :
-	Asset("")
+	Asset(""),
+	m_revision(NextModelRevision())
 	{
 	}
 
@@ -27,11 +101,13 @@ namespace Sce
 	Asset(std::move(filepath)),
 	m_texture(std::move(sharedTexture)),
 	m_vertices(std::move(vertices)),
-	m_indices(std::move(indices))
+	m_indices(std::move(indices)),
+	m_revision(NextModelRevision())
 	{
-		Vector2f maxs(std::numeric_limits<float>::min()); // -Infinity
+		Vector2f maxs(std::numeric_limits<float>::lowest()); // -Infinity
 		Vector2f mins(std::numeric_limits<float>::max()); // +Infinity
 
+		m_positions.resize(m_vertices.size());
 		m_sdlVertices.resize(m_vertices.size());
 		for (std::size_t i = 0; i < m_vertices.size(); ++i)
 		{
@@ -42,10 +118,20 @@ namespace Sce
 			maxs.x = std::max(maxs.x, modelVertex.pos.x);
 			maxs.y = std::max(maxs.y, modelVertex.pos.y);
 			mins.x = std::min(mins.x, modelVertex.pos.x);
-			mins.y = std::min(mins.x, modelVertex.pos.y);
+			mins.y = std::min(mins.y, modelVertex.pos.y);
+
+			m_positions[i] = modelVertex.pos;
 
 			// Conversion de nos structures vers les structures de la SDL
+			sdlVertex.position = SDL_FPoint{ modelVertex.pos.x, modelVertex.pos.y };
 			sdlVertex.tex_coord = SDL_FPoint{ modelVertex.uv.x, modelVertex.uv.y };
+			if (m_texture)
+			{
+				// Les UV du modle couvrent toute sa texture, qui peut n'tre qu'une rgion d'une page d'atlas
+				SDL_FRect texCoords = m_texture->GetTexCoords(m_texture->GetRect());
+				sdlVertex.tex_coord.x = texCoords.x + modelVertex.uv.x * texCoords.w;
+				sdlVertex.tex_coord.y = texCoords.y + modelVertex.uv.y * texCoords.h;
+			}
 
 			std::uint8_t r, g, b, a;
 			modelVertex.color.ToRGBA8(r, g, b, a);
@@ -60,27 +146,79 @@ namespace Sce
 		m_bounds.h = maxs.y - mins.y;
 	}
 
-	void Model::Render(Renderer& renderer, const Matrixf& transformMatrix) const
+	Model::Model(std::shared_ptr<Texture> sharedTexture, std::vector<SDL_Vertex> vertices, std::vector<int> indices, std::string filepath) :
+	Asset(std::move(filepath)),
+	m_texture(std::move(sharedTexture)),
+	m_sdlVertices(std::move(vertices)),
+	m_indices(std::move(indices)),
+	m_revision(NextModelRevision())
 	{
-		assert(m_vertices.size() == m_sdlVertices.size());
+		// Les vertices sont dj au format de la SDL (lus d'un bloc depuis un fichier binaire) : on en dduit nos propres structures
+		// et on ne fait que replacer les UV dans la rgion de la texture
+		Vector2f maxs(std::numeric_limits<float>::lowest());
+		Vector2f mins(std::numeric_limits<float>::max());
 
-		std::vector<SDL_Vertex> vertices = m_sdlVertices;
+		SDL_FRect texCoords = SDL_FRect{ 0.f, 0.f, 1.f, 1.f };
+		if (m_texture)
+			texCoords = m_texture->GetTexCoords(m_texture->GetRect());
 
-		for (std::size_t i = 0; i < m_vertices.size(); ++i)
+		m_vertices.resize(m_sdlVertices.size());
+		m_positions.resize(m_sdlVertices.size());
+		for (std::size_t i = 0; i < m_sdlVertices.size(); ++i)
 		{
-			const ModelVertex& modelVertex = m_vertices[i];
 			SDL_Vertex& sdlVertex = m_sdlVertices[i];
+			ModelVertex& modelVertex = m_vertices[i];
 
-			// tex_coord et color sont dj grs par le constructeur
-			Vector2f transformedPos = (transformMatrix * Matrixf::MakeFromPosition(modelVertex.pos)).GetVector2() + Vector2f{ 1080 / 2, 769 / 2 };
-			sdlVertex.position = SDL_FPoint{ transformedPos.x, transformedPos.y };
-			sdlVertex.color.r = modelVertex.color.r;
-			sdlVertex.color.g = modelVertex.color.g;
-			sdlVertex.color.b = modelVertex.color.b;
-			sdlVertex.color.a = modelVertex.color.a;
+			modelVertex.pos = sdlVertex.position;
+			modelVertex.uv = sdlVertex.tex_coord;
+			modelVertex.color = Color::FromRGBA8(sdlVertex.color.r, sdlVertex.color.g, sdlVertex.color.b, sdlVertex.color.a);
+
+			maxs.x = std::max(maxs.x, modelVertex.pos.x);
+			maxs.y = std::max(maxs.y, modelVertex.pos.y);
+			mins.x = std::min(mins.x, modelVertex.pos.x);
+			mins.y = std::min(mins.y, modelVertex.pos.y);
+
+			m_positions[i] = modelVertex.pos;
+
+			sdlVertex.tex_coord.x = texCoords.x + modelVertex.uv.x * texCoords.w;
+			sdlVertex.tex_coord.y = texCoords.y + modelVertex.uv.y * texCoords.h;
 		}
 
-		renderer.RenderGeometry(*m_texture, m_sdlVertices.data(), static_cast<int>(m_sdlVertices.size()), m_indices.data(), static_cast<int>(m_indices.size()));
+		m_bounds.x = mins.x;
+		m_bounds.y = mins.y;
+		m_bounds.w = maxs.x - mins.x;
+		m_bounds.h = maxs.y - mins.y;
+	}
+
+	void Model::Render(Renderer& renderer, const Affine2f& transformMatrix) const
+	{
+		// Rendu ponctuel, sans instance  qui rattacher les vertices transforms
+		RenderCache cache;
+		RenderInstance(renderer, transformMatrix, cache);
+	}
+
+	void Model::RenderInstance(Renderer& renderer, const Affine2f& transformMatrix, RenderCache& cache) const
+	{
+		assert(m_vertices.size() == m_sdlVertices.size());
+
+		// Comme les autres renderables, le modle est dessin avec la seule matrice reue (la camra se charge de centrer la vue) :
+		// culling et picking le trouvent ainsi l o il est dessin
+		if (cache.revision != m_revision || cache.vertices.size() != m_sdlVertices.size())
+		{
+			// Premier rendu de cette instance (ou modle remplac) : tex_coord et color sont copis une fois pour toutes
+			cache.vertices = m_sdlVertices;
+			cache.revision = m_revision;
+			TransformPoints(transformMatrix, m_positions.data(), cache.vertices.data(), m_positions.size());
+			cache.matrix = transformMatrix;
+		}
+		else if (cache.matrix != transformMatrix)
+		{
+			TransformPoints(transformMatrix, m_positions.data(), cache.vertices.data(), m_positions.size());
+			cache.matrix = transformMatrix;
+		}
+
+		// Le Renderer copie les vertices dans son lot, le cache reste intact pour la frame suivante
+		renderer.RenderGeometry(*m_texture, cache.vertices.data(), static_cast<int>(cache.vertices.size()), m_indices.data(), static_cast<int>(m_indices.size()));
 	}
 
 	bool Model::SaveToFileRegular(const std::string& filepath) const
@@ -150,6 +288,11 @@ namespace Sce
 	}
 
 	bool Model::SaveToFileBinary(const std::string& filepath) const
+	{
+		return SaveToFileBinary(filepath, (m_texture) ? m_texture->GetFilepath() : std::string{}, false);
+	}
+
+	bool Model::SaveToFileBinary(const std::string& filepath, const std::string& texturePath, bool compress) const
 	{
 		std::ofstream file(filepath, std::ios::out | std::ios::binary);
 		if (!file.is_open())
@@ -158,63 +301,81 @@ namespace Sce
 			return false;
 		}
 
-		std::vector<std::uint8_t> buffer;
-
-		SerializeBinary<const std::string&>(buffer, m_texture->GetFilepath());
+		// Les blocs sont construits dans un seul buffer dimensionn  l'avance, puis crits (ou compresss) en une fois
+		std::size_t payloadSize = ComputeBinaryModelPayloadSize(texturePath.size(), m_vertices.size(), m_indices.size());
 
-		SerializeBinary<std::size_t>(buffer, m_indices.size());
-		for (int id : m_indices)
-			SerializeBinary<int>(buffer, id);
+		BinaryWriter payloadWriter;
+		payloadWriter.Reserve(payloadSize);
+		payloadWriter.WriteBytes(texturePath.data(), texturePath.size());
+		payloadWriter.WritePadding(BinaryModelAlignment);
 
-		SerializeBinary<std::size_t>(buffer, m_vertices.size());
-		for (const auto& vertice : m_vertices)
+		// Les UV de m_sdlVertices sont places dans la rgion d'atlas de la texture, on repart donc de m_vertices
+		for (const ModelVertex& modelVertex : m_vertices)
 		{
-			SerializeBinary<float>(buffer, vertice.pos.x);
-			SerializeBinary<float>(buffer, vertice.pos.y);
-			SerializeBinary<float>(buffer, vertice.uv.x);
-			SerializeBinary<float>(buffer, vertice.uv.y);
-			SerializeBinary<Uint8>(buffer, vertice.color.r);
-			SerializeBinary<Uint8>(buffer, vertice.color.g);
-			SerializeBinary<Uint8>(buffer, vertice.color.b);
-			SerializeBinary<Uint8>(buffer, vertice.color.a);
+			SDL_Vertex sdlVertex;
+			sdlVertex.position = modelVertex.pos;
+			sdlVertex.tex_coord = modelVertex.uv;
+			modelVertex.color.ToRGBA8(sdlVertex.color.r, sdlVertex.color.g, sdlVertex.color.b, sdlVertex.color.a);
+
+			payloadWriter.Write(sdlVertex);
 		}
+		payloadWriter.WritePadding(BinaryModelAlignment);
 
-		
-		file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
-		file.close();
-		return true;
-	}
+		static_assert(sizeof(int) == sizeof(std::int32_t));
+		payloadWriter.WriteSpan(std::span<const int>(m_indices));
 
-	Model Model::LoadFromFileRegular(const std::string& filepath)
-	{
-		// Ouverture d'un fichier en lecture
-		std::ifstream inputFile(filepath);
-		if (!inputFile.is_open())
+		assert(payloadWriter.GetPosition() == payloadSize);
+		std::vector<std::uint8_t> payload = payloadWriter.TakeData();
+
+		BinaryModelHeader header = {};
+		std::memcpy(header.magic, BinaryModelMagic.data(), BinaryModelMagic.size());
+		header.version = BinaryModelVersion;
+		header.isBigEndian = IsNativeBigEndian;
+		header.texturePathSize = static_cast<std::uint32_t>(texturePath.size());
+		header.vertexCount = static_cast<std::uint32_t>(m_vertices.size());
+		header.indexCount = static_cast<std::uint32_t>(m_indices.size());
+		header.payloadSize = static_cast<std::uint32_t>(payload.size());
+
+		if (compress && !payload.empty())
 		{
-			fmt::print(stderr, fg(fmt::color::red), "failed to open model file {}\n", filepath);
-			return {}; //< on retourne un Model construit par dfaut (on pourrait galement lancer une exception)
+			std::vector<std::uint8_t> compressedPayload(LZ4_compressBound(static_cast<int>(payload.size())));
+			int compressedSize = LZ4_compress_default(reinterpret_cast<const char*>(payload.data()), reinterpret_cast<char*>(compressedPayload.data()), static_cast<int>(payload.size()), static_cast<int>(compressedPayload.size()));
+			if (compressedSize <= 0)
+			{
+				fmt::print(stderr, fg(fmt::color::red), "failed to compress model file\n");
+				return false;
+			}
+
+			compressedPayload.resize(compressedSize);
+			payload = std::move(compressedPayload);
+			header.flags |= BinaryModelFlag_LZ4;
 		}
 
-		return LoadFromJson(nlohmann::json::parse(inputFile), filepath);
+		header.storedPayloadSize = static_cast<std::uint32_t>(payload.size());
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+
+		return file.good();
 	}
 
-	Model Model::LoadFromFileCompressed(const std::string& filepath)
+	Model Model::LoadFromMemoryRegular(std::span<const std::uint8_t> content, const std::string& filepath, const TextureResolver& textureResolver)
 	{
-		// Ouverture d'un fichier en lecture (en binaire)
-		std::ifstream inputFile(filepath, std::ios::binary);
-		if (!inputFile.is_open())
+		return LoadFromJson(nlohmann::json::parse(content.begin(), content.end()), textureResolver, filepath);
+	}
+
+	Model Model::LoadFromMemoryCompressed(std::span<const std::uint8_t> content, const std::string& filepath, const TextureResolver& textureResolver)
+	{
+		if (content.size() < sizeof(std::uint32_t))
 		{
-			fmt::print(stderr, fg(fmt::color::red), "failed to open model file {}\n", filepath);
-			return {}; //< on retourne un Model construit par dfaut (on pourrait galement lancer une exception)
+			fmt::print(stderr, fg(fmt::color::red), "failed to load model file {}: truncated file\n", filepath);
+			return {};
 		}
 
-		// On lit tout le contenu dans un vector
-		std::vector<char> content((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
-
 		// Nous devons allouer un tableau d'une taille suffisante pour stocker la version dcompresse : problme, nous n'avons pas cette information
 		// Nous l'avons donc stocke dans un std::uint32_t au dbut du fichier
 		std::uint32_t decompressedSize;
-		std::memcpy(&decompressedSize, &content[0], sizeof(std::uint32_t));
+		std::memcpy(&decompressedSize, content.data(), sizeof(std::uint32_t));
 
 		// Petite scurit pour viter les donnes malveillantes : assurons-nous que la taille n'a pas une valeur dlirante
 		if (decompressedSize > 10'000'000) //< La taille dpasse 10MB? vitons
@@ -224,14 +385,17 @@ namespace Sce
 		}
 
 		// Nous pouvons ensuite allouer un tableau d'octets (char), std::vector<char> ferait l'affaire ici mais un unique_ptr suffit amplement
+		// Les donnes compresses sont lues directement depuis leur source (fichier lu ou archive projete en mmoire)
 		std::unique_ptr<char[]> decompressedStr = std::make_unique<char[]>(decompressedSize);
-		if (LZ4_decompress_safe(&content[sizeof(std::uint32_t)], decompressedStr.get(), static_cast<int>(content.size() - sizeof(std::uint32_t)), decompressedSize) <= 0)
+		const char* compressedData = reinterpret_cast<const char*>(content.data() + sizeof(std::uint32_t));
+		int decompressedLength = LZ4_decompress_safe(compressedData, decompressedStr.get(), static_cast<int>(content.size() - sizeof(std::uint32_t)), decompressedSize);
+		if (decompressedLength <= 0)
 		{
 			fmt::print(stderr, fg(fmt::color::red), "failed to load model file {}: corrupt file\n", filepath);
 			return {};
 		}
 
-		return LoadFromJson(nlohmann::json::parse(decompressedStr.get()), filepath);
+		return LoadFromJson(nlohmann::json::parse(decompressedStr.get(), decompressedStr.get() + decompressedLength), textureResolver, filepath);
 	}
 
 	bool Model::SaveToFile(const std::string& filepath) const
@@ -305,6 +469,24 @@ namespace Sce
 		return -10;
 	}
 
+	const Texture* Model::GetTexture() const
+	{
+		return m_texture.get();
+	}
+
+	const std::vector<int>& Model::GetIndices() const
+	{
+		return m_indices;
+	}
+
+	std::size_t Model::GetMemorySize() const
+	{
+		return m_vertices.capacity() * sizeof(ModelVertex)
+		     + m_positions.capacity() * sizeof(Vector2f)
+		     + m_sdlVertices.capacity() * sizeof(SDL_Vertex)
+		     + m_indices.capacity() * sizeof(int);
+	}
+
 	const std::vector<ModelVertex>& Model::GetVertices() const
 	{
 		return m_vertices;
@@ -334,47 +516,122 @@ namespace Sce
 		return renderableDoc;
 	}
 
-	Model Model::LoadFromFileBinary(const std::string& filepath)
+	Model Model::LoadFromMemoryBinary(std::span<const std::uint8_t> buffer, const std::string& filepath, const TextureResolver& textureResolver)
 	{
-		std::ifstream file(filepath);
-		if (!file)
-			throw std::runtime_error("couldn't open file " + filepath);
+		// Les fichiers de la premire version ne commencent pas par l'identifiant du format
+		if (buffer.size() < sizeof(BinaryModelHeader) || std::memcmp(buffer.data(), BinaryModelMagic.data(), BinaryModelMagic.size()) != 0)
+			return LoadFromMemoryBinaryV1(buffer, filepath, textureResolver);
+
+		BinaryModelHeader header;
+		std::memcpy(&header, buffer.data(), sizeof(header));
+
+		// Le fichier a t crit sur une machine d'endianness diffrente : toutes les valeurs de plus d'un octet sont  inverser
+		bool needByteSwap = (header.isBigEndian != 0) != IsNativeBigEndian;
+		if (needByteSwap)
+		{
+			header.version = ByteSwap(header.version);
+			header.texturePathSize = ByteSwap(header.texturePathSize);
+			header.vertexCount = ByteSwap(header.vertexCount);
+			header.indexCount = ByteSwap(header.indexCount);
+			header.payloadSize = ByteSwap(header.payloadSize);
+			header.storedPayloadSize = ByteSwap(header.storedPayloadSize);
+		}
+
+		if (header.version > BinaryModelVersion)
+		{
+			fmt::print(stderr, fg(fmt::color::red), "failed to load model file {}: unknown version {}\n", filepath, header.version);
+			return {};
+		}
 
-		std::vector<std::uint8_t> buffer;
+		std::size_t payloadSize = ComputeBinaryModelPayloadSize(header.texturePathSize, header.vertexCount, header.indexCount);
+		if (payloadSize != header.payloadSize || buffer.size() - sizeof(BinaryModelHeader) < header.storedPayloadSize)
+		{
+			fmt::print(stderr, fg(fmt::color::red), "failed to load model file {}: corrupt file\n", filepath);
+			return {};
+		}
 
-		file.seekg(0, std::ios::end);
-		std::size_t len = file.tellg();
-		file.seekg(0, std::ios::beg);
+		// Sans compression les blocs sont lus directement depuis le buffer (ventuellement une archive projete en mmoire)
+		std::span<const std::uint8_t> payload = buffer.subspan(sizeof(BinaryModelHeader), header.storedPayloadSize);
 
-		buffer.resize(len);
-		file.read(reinterpret_cast<char*>(buffer.data()), len);
+		std::vector<std::uint8_t> decompressedPayload;
+		if (header.flags & BinaryModelFlag_LZ4)
+		{
+			decompressedPayload.resize(header.payloadSize);
+			int decompressedSize = LZ4_decompress_safe(reinterpret_cast<const char*>(payload.data()), reinterpret_cast<char*>(decompressedPayload.data()), static_cast<int>(payload.size()), static_cast<int>(decompressedPayload.size()));
+			if (decompressedSize < 0 || static_cast<std::size_t>(decompressedSize) != header.payloadSize)
+			{
+				fmt::print(stderr, fg(fmt::color::red), "failed to load model file {}: corrupt file\n", filepath);
+				return {};
+			}
+
+			payload = decompressedPayload;
+		}
+		else if (header.storedPayloadSize != header.payloadSize)
+		{
+			fmt::print(stderr, fg(fmt::color::red), "failed to load model file {}: corrupt file\n", filepath);
+			return {};
+		}
 
-		std::size_t offset = 0;
+		BinaryReader payloadReader(payload);
 
-		std::string texpath = UnserializeBinary<std::string>(buffer, offset);
-		std::shared_ptr<Texture> texture = ResourceManager::Instance().GetTexture(texpath);
+		std::string texturePath(header.texturePathSize, '\0');
+		payloadReader.ReadBytes(texturePath.data(), texturePath.size());
+		payloadReader.SkipPadding(BinaryModelAlignment);
 
-		std::size_t indiceNum = UnserializeBinary<std::size_t>(buffer, offset);
-		std::vector<int> indices;
-		for (std::size_t i = 0; i < indiceNum; ++i)
+		// Une seule copie par bloc, directement dans le format utilis pour le rendu
+		std::vector<SDL_Vertex> vertices(header.vertexCount);
+		payloadReader.ReadSpan(std::span<SDL_Vertex>(vertices));
+		payloadReader.SkipPadding(BinaryModelAlignment);
+
+		std::vector<int> indices(header.indexCount);
+		payloadReader.ReadSpan(std::span<int>(indices));
+
+		if (needByteSwap)
 		{
-			int value = UnserializeBinary<int>(buffer, offset);
-			indices.push_back(value);
+			for (SDL_Vertex& vertex : vertices)
+			{
+				vertex.position.x = ByteSwap(vertex.position.x);
+				vertex.position.y = ByteSwap(vertex.position.y);
+				vertex.tex_coord.x = ByteSwap(vertex.tex_coord.x);
+				vertex.tex_coord.y = ByteSwap(vertex.tex_coord.y);
+			}
+
+			for (int& index : indices)
+				index = ByteSwap(index);
 		}
 
-		std::size_t verticesNum = UnserializeBinary<std::size_t>(buffer, offset);
+		std::shared_ptr<Texture> texture = textureResolver(texturePath);
+
+		return Model{ std::move(texture), std::move(vertices), std::move(indices), filepath };
+	}
+
+	Model Model::LoadFromMemoryBinaryV1(std::span<const std::uint8_t> buffer, const std::string& filepath, const TextureResolver& textureResolver)
+	{
+		// Premire version du format, sans en-tte : valeurs crites une par une (chane prcde de sa longueur sur 16 bits)
+		BinaryReader reader(buffer);
+
+		std::string texpath(reader.Read<std::uint16_t>(), '\0');
+		reader.ReadBytes(texpath.data(), texpath.size());
+		std::shared_ptr<Texture> texture = textureResolver(texpath);
+
+		std::size_t indiceNum = reader.Read<std::size_t>();
+		std::vector<int> indices;
+		for (std::size_t i = 0; i < indiceNum; ++i)
+			indices.push_back(reader.Read<int>());
+
+		std::size_t verticesNum = reader.Read<std::size_t>();
 		std::vector<SDL_Vertex> vertices;
 		for (std::size_t i = 0; i < verticesNum; ++i)
 		{
 			SDL_Vertex v;
-			v.position.x = UnserializeBinary<float>(buffer, offset);
-			v.position.y = UnserializeBinary<float>(buffer, offset);
-			v.tex_coord.x = UnserializeBinary<float>(buffer, offset);
-			v.tex_coord.y = UnserializeBinary<float>(buffer, offset);
-			v.color.r = UnserializeBinary<char>(buffer, offset);
-			v.color.g = UnserializeBinary<char>(buffer, offset);
-			v.color.b = UnserializeBinary<char>(buffer, offset);
-			v.color.a = UnserializeBinary<char>(buffer, offset);
+			v.position.x = reader.Read<float>();
+			v.position.y = reader.Read<float>();
+			v.tex_coord.x = reader.Read<float>();
+			v.tex_coord.y = reader.Read<float>();
+			v.color.r = reader.Read<std::uint8_t>();
+			v.color.g = reader.Read<std::uint8_t>();
+			v.color.b = reader.Read<std::uint8_t>();
+			v.color.a = reader.Read<std::uint8_t>();
 			vertices.push_back(v);
 		}
 
@@ -394,17 +651,46 @@ namespace Sce
 			};
 		}
 
-		return Model{ std::move(texture), std::move(modelVertex), std::move(indices), texpath};
+		return Model{ std::move(texture), std::move(modelVertex), std::move(indices), filepath };
 	}
 
 	Model Model::LoadFromFile(const std::string& filepath)
 	{
+		return LoadFromFile(filepath, &ResolveTextureFromResourceManager);
+	}
+
+	Model Model::LoadFromFile(const std::string& filepath, const TextureResolver& textureResolver)
+	{
+		// Ouverture d'un fichier en lecture (en binaire)
+		std::ifstream inputFile(filepath, std::ios::binary);
+		if (!inputFile.is_open())
+		{
+			fmt::print(stderr, fg(fmt::color::red), "failed to open model file {}\n", filepath);
+			return {}; //< on retourne un Model construit par dfaut (on pourrait galement lancer une exception)
+		}
+
+		// On lit tout le contenu dans un vector
+		std::vector<std::uint8_t> content((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
+
+		return LoadFromMemory(filepath, content.data(), content.size(), textureResolver);
+	}
+
+	Model Model::LoadFromMemory(const std::string& filepath, const void* data, std::size_t size)
+	{
+		return LoadFromMemory(filepath, data, size, &ResolveTextureFromResourceManager);
+	}
+
+	Model Model::LoadFromMemory(const std::string& filepath, const void* data, std::size_t size, const TextureResolver& textureResolver)
+	{
+		// Le chemin ne sert qu' identifier le format (par son extension) et le modle
+		std::span<const std::uint8_t> content(static_cast<const std::uint8_t*>(data), size);
+
 		if (filepath.ends_with(".model"))
-			return LoadFromFileRegular(filepath);
+			return LoadFromMemoryRegular(content, filepath, textureResolver);
 		else if (filepath.ends_with(".cmodel"))
-			return LoadFromFileCompressed(filepath);
+			return LoadFromMemoryCompressed(content, filepath, textureResolver);
 		else if (filepath.ends_with(".bmodel"))
-			return LoadFromFileBinary(filepath);
+			return LoadFromMemoryBinary(content, filepath, textureResolver);
 		else
 		{
 			fmt::print(stderr, fg(fmt::color::red), "unknown extension {}\n", filepath.substr(filepath.find_last_of(".")));
@@ -412,13 +698,30 @@ namespace Sce
 		}
 	}
 
-	Model Model::LoadFromJson(const nlohmann::json& doc,std::string filepath)
+	bool Model::ConvertToBinary(const std::string& sourcePath, const std::string& destinationPath, bool compress)
+	{
+		// Aucune texture n'est charge : seul son chemin est ncessaire pour crire le fichier
+		std::string texturePath;
+		Model model = LoadFromFile(sourcePath, [&](const std::string& path) -> std::shared_ptr<Texture>
+		{
+			texturePath = path;
+			return nullptr;
+		});
+
+		if (!model.IsValid())
+			return false;
+
+		return model.SaveToFileBinary(destinationPath, texturePath, compress);
+	}
+
+	Model Model::LoadFromJson(const nlohmann::json& doc, std::string filepath)
 	{
-		std::ifstream file(filepath);
-		if (!file)
-			throw std::runtime_error("couldn't open file " + filepath);
+		return LoadFromJson(doc, &ResolveTextureFromResourceManager, std::move(filepath));
+	}
 
-		std::shared_ptr<Texture> texture = ResourceManager::Instance().GetTexture(doc.at("texture"));
+	Model Model::LoadFromJson(const nlohmann::json& doc, const TextureResolver& textureResolver, std::string filepath)
+	{
+		std::shared_ptr<Texture> texture = textureResolver(doc.at("texture"));
 
 		std::vector<SDL_Vertex> vertices = doc.at("vertices");
 		std::vector<ModelVertex> modelVertices;
@@ -439,6 +742,11 @@ namespace Sce
 		return Model{ std::move(texture), std::move(modelVertices), doc.at("indices"), filepath};
 	}
 
+	std::shared_ptr<Texture> Model::ResolveTextureFromResourceManager(const std::string& texturePath)
+	{
+		return ResourceManager::Instance().GetTexture(texturePath);
+	}
+
 	std::shared_ptr<Model> Model::Unserialize(const nlohmann::json& doc)
 	{
 		std::string filepath = doc.value("Path", "");
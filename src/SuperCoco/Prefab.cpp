@@ -0,0 +1,127 @@
+#include <SuperCoco/Prefab.hpp>
+#include <SuperCoco/ComponentRegistry.hpp>
+#include <fmt/color.h>
+#include <fmt/core.h>
+#include <nlohmann/json.hpp>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+namespace Sce
+{
+	constexpr unsigned int PrefabVersion = 1;
+
+	Prefab::Prefab(const ComponentRegistry& componentRegistry, std::string filepath) :
+	Asset(std::move(filepath)),
+	m_prototypeRegistry(std::make_unique<entt::registry>()),
+	m_componentRegistry(&componentRegistry)
+	{
+		m_prototype = m_prototypeRegistry->create();
+	}
+
+	Prefab::Prefab(Prefab&& prefab) noexcept = default;
+
+	Prefab::~Prefab() = default;
+
+	const ComponentRegistry& Prefab::GetComponentRegistry() const
+	{
+		return *m_componentRegistry;
+	}
+
+	entt::handle Prefab::GetPrototype()
+	{
+		return entt::handle(*m_prototypeRegistry, m_prototype);
+	}
+
+	entt::handle Prefab::Instantiate(entt::registry& registry) const
+	{
+		entt::entity entity;
+		Instantiate(registry, std::span<entt::entity>(&entity, 1));
+
+		return entt::handle(registry, entity);
+	}
+
+	void Prefab::Instantiate(entt::registry& registry, std::span<entt::entity> entities) const
+	{
+		registry.create(entities.begin(), entities.end());
+
+		// Les entrées sont parcourues dans l'ordre du ComponentRegistry : un composant dépendant d'un autre
+		// (la spritesheet anime le sprite du GraphicsComponent) est ajouté après lui
+		entt::handle prototype(*m_prototypeRegistry, m_prototype);
+		m_componentRegistry->ForEachComponent([&](const ComponentRegistry::Entry& entry)
+		{
+			if (!entry.hasComponent || !entry.hasComponent(prototype))
+				return;
+
+			if (entry.instantiate)
+			{
+				entry.instantiate(*m_prototypeRegistry, m_prototype, registry, entities);
+				return;
+			}
+
+			if (!entry.serialize || !entry.unserialize)
+				return;
+
+			nlohmann::json componentDoc = entry.serialize(prototype);
+			for (entt::entity entity : entities)
+				entry.unserialize(entt::handle(registry, entity), componentDoc);
+		});
+	}
+
+	Prefab& Prefab::operator=(Prefab&& prefab) noexcept = default;
+
+	Prefab Prefab::LoadFromFile(const std::string& filepath, const ComponentRegistry& componentRegistry)
+	{
+		std::ifstream file(filepath, std::ios::binary);
+		if (!file)
+			throw std::runtime_error("failed to open " + filepath);
+
+		std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		return LoadFromMemory(filepath, content.data(), content.size(), componentRegistry);
+	}
+
+	Prefab Prefab::LoadFromJson(const std::string& filepath, const nlohmann::json& doc, const ComponentRegistry& componentRegistry)
+	{
+		unsigned int version = doc.at("Version");
+		if (version > PrefabVersion)
+			throw std::runtime_error(fmt::format("unknown file version {}", version));
+
+		Prefab prefab(componentRegistry, filepath);
+		entt::handle prototype = prefab.GetPrototype();
+
+		const nlohmann::json& componentsDoc = doc.at("Components");
+		for (auto it = componentsDoc.begin(); it != componentsDoc.end(); ++it)
+		{
+			const ComponentRegistry::Entry* entry = componentRegistry.FindComponent(it.key());
+			if (!entry || !entry->unserialize)
+				fmt::print(fg(fmt::color::yellow), "{}: ignoring unknown component {}\n", filepath, it.key());
+		}
+
+		// Désérialisation dans l'ordre du ComponentRegistry (et non du document) pour les composants dépendant d'un autre
+		componentRegistry.ForEachComponent([&](const ComponentRegistry::Entry& entry)
+		{
+			if (!entry.unserialize)
+				return;
+
+			auto it = componentsDoc.find(entry.id);
+			if (it != componentsDoc.end())
+				entry.unserialize(prototype, it.value());
+		});
+
+		return prefab;
+	}
+
+	Prefab Prefab::LoadFromMemory(const std::string& filepath, const void* data, std::size_t size, const ComponentRegistry& componentRegistry)
+	{
+		const std::uint8_t* begin = static_cast<const std::uint8_t*>(data);
+
+		nlohmann::json doc;
+		if (filepath.ends_with(".bprefab"))
+			doc = nlohmann::json::from_cbor(begin, begin + size);
+		else
+			doc = nlohmann::json::parse(begin, begin + size);
+
+		return LoadFromJson(filepath, doc, componentRegistry);
+	}
+}
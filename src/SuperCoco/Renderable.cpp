@@ -0,0 +1,9 @@
+#include <SuperCoco/Renderable.hpp>
+
+namespace Sce
+{
+	void IRenderable::RenderInstance(Renderer& renderer, const Affine2f& transformMatrix, RenderCache& /*cache*/) const
+	{
+		Render(renderer, transformMatrix);
+	}
+}
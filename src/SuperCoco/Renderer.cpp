@@ -6,7 +6,9 @@
 
 namespace Sce
 {
-	Renderer::Renderer(Window& window, int renderer, std::uint32_t flags)
+	Renderer::Renderer(Window& window, int renderer, std::uint32_t flags) :
+	m_batchTexture(nullptr),
+	m_isBatching(false)
 	{
 		m_renderer = SDL_CreateRenderer(window.GetHandle(), renderer, flags);
 		if (!m_renderer)
@@ -18,14 +20,53 @@ namespace Sce
 		SDL_DestroyRenderer(m_renderer);
 	}
 
+	void Renderer::BeginBatch()
+	{
+		m_isBatching = true;
+	}
+
+	void Renderer::EndBatch()
+	{
+		FlushBatch();
+		m_isBatching = false;
+	}
+
+	void Renderer::FlushBatch()
+	{
+		if (m_batchIndices.empty())
+			return;
+
+		DrawGeometry(m_batchTexture, m_batchVertices.data(), static_cast<int>(m_batchVertices.size()), m_batchIndices.data(), static_cast<int>(m_batchIndices.size()));
+
+		// clear() conserve la capacité : les frames suivantes n'allouent plus
+		m_batchVertices.clear();
+		m_batchIndices.clear();
+		m_batchTexture = nullptr;
+	}
+
+	const Renderer::FrameStats& Renderer::GetFrameStats() const
+	{
+		return m_lastFrameStats;
+	}
+
+	bool Renderer::IsBatching() const
+	{
+		return m_isBatching;
+	}
+
 	void Renderer::RenderClear()
 	{
+		FlushBatch();
 		SDL_RenderClear(m_renderer);
 	}
 
 	void Renderer::RenderPresent()
 	{
+		FlushBatch();
 		SDL_RenderPresent(m_renderer);
+
+		m_lastFrameStats = m_currentStats;
+		m_currentStats = FrameStats{};
 	}
 
 	void Renderer::RenderDrawColor(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
@@ -35,37 +76,43 @@ namespace Sce
 
 	void Renderer::RenderCopy(const Texture& texture)
 	{
-		SDL_RenderCopy(m_renderer, texture.GetTextureHandle(), nullptr, nullptr);
+		FlushBatch();
+		SDL_RenderCopy(m_renderer, texture.GetTextureHandle(), &texture.GetRegion(), nullptr);
 	}
 
 	void Renderer::RenderCopy(const Texture& texture, const SDL_Rect& dstrect)
 	{
-		SDL_RenderCopy(m_renderer, texture.GetTextureHandle(), nullptr, &dstrect);
+		FlushBatch();
+		SDL_RenderCopy(m_renderer, texture.GetTextureHandle(), &texture.GetRegion(), &dstrect);
 	}
 
 	void Renderer::RenderCopy(const Texture& texture, const SDL_Rect& srcrect, const SDL_Rect& dstrect)
 	{
-		SDL_RenderCopy(m_renderer, texture.GetTextureHandle(), &srcrect, &dstrect);
+		FlushBatch();
+		// srcrect est relatif à la texture, qui peut être une région d'une page d'atlas
+		const SDL_Rect& region = texture.GetRegion();
+		SDL_Rect pageRect{ region.x + srcrect.x, region.y + srcrect.y, srcrect.w, srcrect.h };
+		SDL_RenderCopy(m_renderer, texture.GetTextureHandle(), &pageRect, &dstrect);
 	}
 
 	void Renderer::RenderGeometry(const SDL_Vertex* vertices, int numVertices)
 	{
-		SDL_RenderGeometry(m_renderer, nullptr, vertices, numVertices, nullptr, 0);
+		SubmitGeometry(nullptr, vertices, numVertices, nullptr, 0);
 	}
 
 	void Renderer::RenderGeometry(const Texture& texture, const SDL_Vertex* vertices, int numVertices)
 	{
-		SDL_RenderGeometry(m_renderer, texture.GetTextureHandle(), vertices, numVertices, nullptr, 0);
+		SubmitGeometry(texture.GetTextureHandle(), vertices, numVertices, nullptr, 0);
 	}
 
 	void Renderer::RenderGeometry(const SDL_Vertex* vertices, int numVertices, const int* indices, int numIndices)
 	{
-		SDL_RenderGeometry(m_renderer, nullptr, vertices, numVertices, indices, numIndices);
+		SubmitGeometry(nullptr, vertices, numVertices, indices, numIndices);
 	}
 
 	void Renderer::RenderGeometry(const Texture& texture, const SDL_Vertex* vertices, int numVertices, const int* indices, int numIndices)
 	{
-		SDL_RenderGeometry(m_renderer, texture.GetTextureHandle(), vertices, numVertices, indices, numIndices);
+		SubmitGeometry(texture.GetTextureHandle(), vertices, numVertices, indices, numIndices);
 	}
 
 	void Renderer::SetDrawColor(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
@@ -75,6 +122,50 @@ namespace Sce
 
 	void Renderer::RenderLines(const SDL_FPoint* points, std::size_t count)
 	{
+		FlushBatch();
 		SDL_RenderDrawLinesF(m_renderer, points, static_cast<int>(count));
 	}
+
+	void Renderer::DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices, const int* indices, int numIndices)
+	{
+		SDL_RenderGeometry(m_renderer, texture, vertices, numVertices, indices, numIndices);
+
+		m_currentStats.drawCalls++;
+		m_currentStats.vertexCount += numVertices;
+		m_currentStats.indexCount += numIndices;
+	}
+
+	void Renderer::SubmitGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices, const int* indices, int numIndices)
+	{
+		m_currentStats.submittedGeometries++;
+
+		if (!m_isBatching)
+		{
+			DrawGeometry(texture, vertices, numVertices, indices, numIndices);
+			return;
+		}
+
+		// Les renderables arrivent déjà triés par layer : tant que la texture ne change pas
+		// on peut fusionner sans modifier l'ordre d'affichage
+		if (texture != m_batchTexture)
+		{
+			FlushBatch();
+			m_batchTexture = texture;
+		}
+
+		int firstIndex = static_cast<int>(m_batchVertices.size());
+		m_batchVertices.insert(m_batchVertices.end(), vertices, vertices + numVertices);
+
+		if (indices)
+		{
+			for (int i = 0; i < numIndices; ++i)
+				m_batchIndices.push_back(firstIndex + indices[i]);
+		}
+		else
+		{
+			// Géométrie non indexée : chaque triplet de sommets forme un triangle
+			for (int i = 0; i < numVertices; ++i)
+				m_batchIndices.push_back(firstIndex + i);
+		}
+	}
 }
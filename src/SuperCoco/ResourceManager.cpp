@@ -1,20 +1,38 @@
 #include <SuperCoco/ResourceManager.hpp>
+#include <SuperCoco/AssetArchive.hpp>
+#include <SuperCoco/FileWatcher.hpp>
 #include <SuperCoco/Renderer.hpp>
 #include <SuperCoco/Texture.hpp>
+#include <SuperCoco/TextureAtlas.hpp>
 #include <SuperCoco/Surface.hpp>
 #include <SuperCoco/SpriteSheet.hpp>
 #include <SuperCoco/Model.hpp>
+#include <SuperCoco/Prefab.hpp>
 #include <SuperCoco/Font.hpp>
+#include <SuperCoco/ThreadPool.hpp>
 #include <SDL2/SDL.h>
 #include <fmt/core.h>
 #include <fmt/color.h>
+#include <algorithm>
+#include <limits>
+#include <optional>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 namespace Sce
 {
 	ResourceManager* ResourceManager::s_instance = nullptr;
 
-	ResourceManager::ResourceManager(Renderer* renderer) :
+	// Environ quatre textures 256x256 RGBA par frame
+	constexpr std::size_t DefaultUploadBudget = 4 * 256 * 256 * 4;
+
+	ResourceManager::ResourceManager(Renderer* renderer, std::size_t loaderThreadCount) :
+	m_textureAtlas(std::make_unique<TextureAtlas>(renderer)),
+	m_memoryBudget(0),
+	m_uploadBudget(DefaultUploadBudget),
+	m_currentFrame(0),
+	m_loaderPool(std::make_unique<ThreadPool>(loaderThreadCount)),
 	m_renderer(renderer)
 	{
 		if (!s_instance)
@@ -26,9 +44,22 @@ namespace Sce
 
 	ResourceManager::~ResourceManager()
 	{
+		// Attend la fin des chargements en cours avant de librer les ressources qu'ils rfrencent
+		m_loaderPool.reset();
+
 		s_instance = nullptr;
 	}
 
+	std::size_t ResourceManager::MemoryStats::GetEvictableTotal() const
+	{
+		return fontBytes + modelBytes + spritesheetBytes + textureBytes;
+	}
+
+	std::size_t ResourceManager::MemoryStats::GetTotal() const
+	{
+		return GetEvictableTotal() + pinnedBytes;
+	}
+
 	ResourceManager& ResourceManager::Instance()
 	{
 		return *s_instance;
@@ -36,108 +67,927 @@ namespace Sce
 
 	void ResourceManager::Purge()
 	{
-		for (auto i = m_textures.begin(); i != m_textures.end();)
+		// Les prefabs n'ont pas de taille mesurable (un registre EnTT priv) et restent hors budget : ils ne sont librs qu'ici,
+		// avant le reste pour que les ressources qu'ils taient seuls  rfrencer puissent partir avec eux
+		std::erase_if(m_prefabs, [](const auto& pair) { return !IsReferenced(pair.second.asset); });
+
+		EvictUnused(std::numeric_limits<std::size_t>::max());
+	}
+
+	template<typename T>
+	std::shared_ptr<T>* ResourceManager::FindCached(Cache<T>& cache, const std::string& key)
+	{
+		auto it = cache.find(key);
+		if (it == cache.end())
+			return nullptr;
+
+		it->second.lastUsedFrame = m_currentFrame;
+		return &it->second.asset;
+	}
+
+	template<typename T>
+	bool ResourceManager::IsReferenced(const std::shared_ptr<T>& asset)
+	{
+		// Une rgion d'atlas est aussi rfrence par son atlas, cette rfrence-l ne compte pas
+		long ownerCount = 1;
+		if constexpr (std::is_same_v<T, Texture>)
+		{
+			if (asset->IsAtlasRegion())
+				ownerCount = 2;
+		}
+
+		return asset.use_count() > ownerCount;
+	}
+
+	template<typename T>
+	const std::shared_ptr<T>& ResourceManager::StoreCached(Cache<T>& cache, const std::string& key, std::shared_ptr<T> asset)
+	{
+		CacheEntry<T>& entry = cache[key];
+		entry.asset = std::move(asset);
+		entry.lastUsedFrame = m_currentFrame;
+
+		// La cl des polices contient leur taille, GetFont surveille leur fichier lui-mme
+		if constexpr (!std::is_same_v<T, Font>)
+		{
+			if (m_fileWatcher && !IsArchived(key))
+				m_fileWatcher->Watch(key);
+		}
+
+		return entry.asset;
+	}
+
+	void ResourceManager::EvictUnused(std::size_t bytesToFree)
+	{
+		enum class CacheType
 		{
-			if (i->second.use_count() <= 1)
+			Font,
+			Model,
+			Spritesheet,
+			Texture
+		};
+
+		struct Candidate
+		{
+			std::string key;
+			std::uint64_t lastUsedFrame;
+			std::size_t memorySize;
+			CacheType cacheType;
+		};
+
+		// Une ressource n'est librable que si personne d'autre que le cache (et son atlas) ne la rfrence :
+		// les ressources "manquantes" (rfrences par le ResourceManager) ne le sont jamais
+		std::vector<Candidate> candidates;
+		auto collect = [&](const auto& cache, CacheType cacheType)
+		{
+			for (const auto& [key, entry] : cache)
 			{
-				fmt::print("Unused entry found, erasing entry...\n");
-				i = m_textures.erase(i);
+				if (!IsReferenced(entry.asset))
+					candidates.push_back(Candidate{ key, entry.lastUsedFrame, entry.asset->GetMemorySize(), cacheType });
 			}
-			else
+		};
+
+		collect(m_fonts, CacheType::Font);
+		collect(m_models, CacheType::Model);
+		collect(m_spritesheets, CacheType::Spritesheet);
+		collect(m_textures, CacheType::Texture);
+
+		std::sort(candidates.begin(), candidates.end(), [](const Candidate& lhs, const Candidate& rhs)
+		{
+			return lhs.lastUsedFrame < rhs.lastUsedFrame;
+		});
+
+		std::size_t evictedCount = 0;
+		std::size_t freedBytes = 0;
+		for (const Candidate& candidate : candidates)
+		{
+			if (freedBytes >= bytesToFree)
+				break;
+
+			switch (candidate.cacheType)
 			{
-				i++;
+				case CacheType::Font: m_fonts.erase(candidate.key); break;
+				case CacheType::Model: m_models.erase(candidate.key); break;
+				case CacheType::Spritesheet: m_spritesheets.erase(candidate.key); break;
+				case CacheType::Texture:
+				{
+					// Une rgion ne libre rien  elle seule : c'est sa page qui est libre, une fois toutes ses rgions abandonnes
+					auto it = m_textures.find(candidate.key);
+					bool isAtlasRegion = it->second.asset->IsAtlasRegion();
+					m_textures.erase(it);
+					if (isAtlasRegion)
+						freedBytes += m_textureAtlas->ReleaseUnusedPages();
+
+					break;
+				}
 			}
-			
+
+			evictedCount++;
+			freedBytes += candidate.memorySize;
 		}
+
+		if (evictedCount > 0)
+			fmt::print("Evicted {0} unused resources ({1} bytes)\n", evictedCount, freedBytes);
 	}
 
 	const std::shared_ptr<Model>& ResourceManager::GetModel(const std::string& modelPath)
 	{
 		// Avons-nous dj ce modle en stock ?
-		auto it = m_models.find(modelPath);
-		if (it != m_models.end())
-			return it->second; // Oui, on peut le renvoyer
+		if (std::shared_ptr<Model>* model = FindCached(m_models, modelPath))
+			return *model; // Oui, on peut le renvoyer
 
 		// Non, essayons de le charger
-		Model model = Model::LoadFromFile(modelPath);
+		Model model = LoadModel(modelPath, [this](const std::string& texturePath) { return GetTexture(texturePath); });
 		if (!model.IsValid())
 		{
 			// On a pas pu charger le modle, utilisons un modle "manquant"
-			if (!m_missingModel)
-				m_missingModel = std::make_shared<Model>();
-
-			m_models.emplace(modelPath, m_missingModel);
-			return m_missingModel;
+			return StoreCached(m_models, modelPath, GetMissingModel());
 		}
 
-		it = m_models.emplace(modelPath, std::make_shared<Model>(std::move(model))).first;
-		return it->second;
+		return StoreCached(m_models, modelPath, std::make_shared<Model>(std::move(model)));
 	}
 
 	const std::shared_ptr<Texture>& ResourceManager::GetTexture(const std::string& filepath)
 	{
-		auto resource = m_textures.find(filepath);
-		if (resource != m_textures.end())
-			return resource->second;
+		if (std::shared_ptr<Texture>* texture = FindCached(m_textures, filepath))
+			return *texture;
+
+		// Les textures d'un atlas pr-construit n'ont pas besoin d'tre charges individuellement
+		if (m_prebuiltAtlas)
+		{
+			if (std::shared_ptr<Texture> region = m_prebuiltAtlas->Find(filepath))
+				return StoreCached(m_textures, filepath, std::move(region));
+		}
+
 		try 
 		{
-			std::shared_ptr<Texture> texture = std::make_shared<Texture>(Texture::LoadFromFile(*m_renderer, filepath));
-			texture->m_path = filepath;
-			resource = m_textures.emplace(filepath, std::move(texture)).first;
-			return resource->second;
+			Surface surface = LoadSurface(filepath);
+
+			return StoreCached(m_textures, filepath, CreateTexture(filepath, surface));
 		}
 		catch (const std::exception& e)
 		{
 			fmt::print(fg(fmt::color::red), "failed to load {0}: {1}\n", filepath, e.what());
-			if (!m_missingTexture)
-			{
-				Surface missing = Surface::Create(64, 64);
-				missing.FillRect(SDL_Rect{0, 0, 16, 16}, 254, 0, 254, 255);
-				missing.FillRect(SDL_Rect{ 16, 0, 16, 16 }, 0, 0, 0, 255);
-				missing.FillRect(SDL_Rect{ 0, 16, 16, 16 }, 0, 0, 0, 255);
-				missing.FillRect(SDL_Rect{16, 16, 16, 16}, 254, 0, 254, 255);
+			return GetMissingTexture();
+		}
+	}
 
-				m_missingTexture = std::make_shared<Texture>(Texture::CreateFromSurface(*m_renderer, missing));
-				return m_missingTexture;
-			}
+	std::shared_ptr<Texture> ResourceManager::CreateTexture(const std::string& filepath, const Surface& surface)
+	{
+		// On essaie de ranger la texture dans une page de l'atlas afin qu'elle puisse tre dessine en mme temps que les autres,
+		// seules les textures trop grandes pour une page ont leur propre SDL_Texture
+		std::shared_ptr<Texture> texture = m_textureAtlas->Insert(filepath, surface);
+		if (!texture)
+		{
+			texture = std::make_shared<Texture>(Texture::CreateFromSurface(*m_renderer, surface));
+			texture->m_path = filepath;
 		}
 
+		return texture;
+	}
+
+	const std::shared_ptr<Model>& ResourceManager::GetMissingModel()
+	{
+		if (!m_missingModel)
+			m_missingModel = std::make_shared<Model>();
+
+		return m_missingModel;
+	}
+
+	const std::shared_ptr<Spritesheet>& ResourceManager::GetMissingSpritesheet()
+	{
+		if (!m_missingSpritesheet)
+			m_missingSpritesheet = std::make_shared<Spritesheet>();
+
+		return m_missingSpritesheet;
+	}
+
+	const std::shared_ptr<Texture>& ResourceManager::GetMissingTexture()
+	{
+		if (!m_missingTexture)
+		{
+			Surface missing = Surface::Create(64, 64);
+			missing.FillRect(SDL_Rect{0, 0, 16, 16}, 254, 0, 254, 255);
+			missing.FillRect(SDL_Rect{ 16, 0, 16, 16 }, 0, 0, 0, 255);
+			missing.FillRect(SDL_Rect{ 0, 16, 16, 16 }, 0, 0, 0, 255);
+			missing.FillRect(SDL_Rect{16, 16, 16, 16}, 254, 0, 254, 255);
+
+			m_missingTexture = std::make_shared<Texture>(Texture::CreateFromSurface(*m_renderer, missing));
+		}
+
+		return m_missingTexture;
+	}
+
+	bool ResourceManager::LoadTextureAtlas(const std::string& manifestPath)
+	{
+		try
+		{
+			m_prebuiltAtlas = std::make_unique<TextureAtlas>(TextureAtlas::LoadFromManifest(m_renderer, manifestPath));
+			return true;
+		}
+		catch (const std::exception& e)
+		{
+			fmt::print(fg(fmt::color::red), "failed to load texture atlas {0}: {1}\n", manifestPath, e.what());
+			return false;
+		}
 	}
 
 	const std::shared_ptr<Spritesheet>& ResourceManager::GetSpritesheet(const std::string& spritesheetPath)
 	{
-		auto it = m_spritesheets.find(spritesheetPath);
-		if (it != m_spritesheets.end())
-			return it->second;
+		if (std::shared_ptr<Spritesheet>* spritesheet = FindCached(m_spritesheets, spritesheetPath))
+			return *spritesheet;
 
 		try
 		{
-			std::shared_ptr<Spritesheet> spritesheet = std::make_shared<Spritesheet>(Spritesheet::LoadFromFile(spritesheetPath));
-			it = m_spritesheets.emplace(spritesheetPath, std::move(spritesheet)).first;
-			return it->second;
+			return StoreCached(m_spritesheets, spritesheetPath, std::make_shared<Spritesheet>(LoadSpritesheet(spritesheetPath)));
 		}
 		catch (const std::exception& e)
 		{
 			fmt::print(fg(fmt::color::red), "failed to load {0}: {1}", spritesheetPath, e.what());
 
-			if (!m_missingSpritesheet)
-				m_missingSpritesheet = std::make_shared<Spritesheet>();
-
-			m_spritesheets.emplace(spritesheetPath, m_missingSpritesheet);
-			return m_missingSpritesheet;
+			return StoreCached(m_spritesheets, spritesheetPath, GetMissingSpritesheet());
 		}
 	}
 
 	const std::shared_ptr<Font>& ResourceManager::GetFont(const std::string& fontPath, uint8_t size)
 	{
 		std::string id = fontPath + ";" + std::to_string(size);
-		std::unordered_map<std::string, std::shared_ptr<Font>>::iterator font = m_fonts.find(id);
-		if (font != m_fonts.end())
-			return font->second;
+		if (std::shared_ptr<Font>* font = FindCached(m_fonts, id))
+			return *font;
+
+		if (m_fileWatcher && !IsArchived(fontPath))
+			m_fileWatcher->Watch(fontPath);
 
-		std::shared_ptr<Font> newfont = std::make_shared<Font>(Font::OpenFont(*m_renderer, fontPath, size));
-		m_fonts.emplace(id, newfont);
-		return newfont;
+		return StoreCached(m_fonts, id, std::make_shared<Font>(OpenFont(fontPath, size)));
 	}
 
+	const std::shared_ptr<Prefab>& ResourceManager::GetPrefab(const std::string& prefabPath, const ComponentRegistry& componentRegistry)
+	{
+		if (std::shared_ptr<Prefab>* prefab = FindCached(m_prefabs, prefabPath))
+			return *prefab;
+
+		try
+		{
+			return StoreCached(m_prefabs, prefabPath, std::make_shared<Prefab>(LoadPrefab(prefabPath, componentRegistry)));
+		}
+		catch (const std::exception& e)
+		{
+			fmt::print(fg(fmt::color::red), "failed to load {0}: {1}\n", prefabPath, e.what());
+
+			// Un prefab vide : ses instances sont des entits sans composant
+			return StoreCached(m_prefabs, prefabPath, std::make_shared<Prefab>(componentRegistry, prefabPath));
+		}
+	}
+
+	bool ResourceManager::MountArchive(const std::string& archivePath)
+	{
+		try
+		{
+			// L'ouverture (la projection) se fait hors du verrou, seul l'ajout  la liste bloque les threads de chargement
+			auto archive = std::make_unique<AssetArchive>(AssetArchive::Open(archivePath));
+			std::size_t entryCount = archive->GetEntryCount();
+			{
+				std::unique_lock lock(m_archiveMutex);
+				m_archives.push_back(std::move(archive));
+			}
+
+			fmt::print("Mounted {0} ({1} files)\n", archivePath, entryCount);
+			return true;
+		}
+		catch (const std::exception& e)
+		{
+			fmt::print(fg(fmt::color::red), "failed to mount asset archive {0}: {1}\n", archivePath, e.what());
+			return false;
+		}
+	}
+
+	const AssetArchive* ResourceManager::FindArchive(const std::string& filepath) const
+	{
+		// Les archives ne sont jamais dmontes : le pointeur renvoy reste valide une fois le verrou relch
+		std::shared_lock lock(m_archiveMutex);
+		for (auto it = m_archives.rbegin(); it != m_archives.rend(); ++it)
+		{
+			if ((*it)->Contains(filepath))
+				return it->get();
+		}
+
+		return nullptr;
+	}
+
+	bool ResourceManager::IsArchived(const std::string& filepath) const
+	{
+		return FindArchive(filepath) != nullptr;
+	}
+
+	Font ResourceManager::OpenFont(const std::string& fontPath, int size) const
+	{
+		// SDL_ttf lit la police pendant toute sa dure de vie : seule une entre stocke sans compression
+		// (donc lue directement dans la projection, qui survit aux caches) peut tre utilise depuis l'archive
+		std::vector<std::uint8_t> buffer;
+		if (const AssetArchive* archive = FindArchive(fontPath))
+		{
+			if (auto data = archive->Read(fontPath, buffer); data && buffer.empty())
+				return Font::OpenFontFromMemory(*m_renderer, fontPath, data->data(), data->size(), size);
+		}
+
+		return Font::OpenFont(*m_renderer, fontPath, size);
+	}
+
+	Model ResourceManager::LoadModel(const std::string& modelPath, const std::function<std::shared_ptr<Texture>(const std::string&)>& textureResolver) const
+	{
+		std::vector<std::uint8_t> buffer;
+		if (const AssetArchive* archive = FindArchive(modelPath))
+		{
+			if (auto data = archive->Read(modelPath, buffer))
+				return Model::LoadFromMemory(modelPath, data->data(), data->size(), textureResolver);
+		}
+
+		return Model::LoadFromFile(modelPath, textureResolver);
+	}
+
+	Prefab ResourceManager::LoadPrefab(const std::string& prefabPath, const ComponentRegistry& componentRegistry) const
+	{
+		std::vector<std::uint8_t> buffer;
+		if (const AssetArchive* archive = FindArchive(prefabPath))
+		{
+			if (auto data = archive->Read(prefabPath, buffer))
+				return Prefab::LoadFromMemory(prefabPath, data->data(), data->size(), componentRegistry);
+		}
+
+		return Prefab::LoadFromFile(prefabPath, componentRegistry);
+	}
+
+	Spritesheet ResourceManager::LoadSpritesheet(const std::string& spritesheetPath) const
+	{
+		std::vector<std::uint8_t> buffer;
+		if (const AssetArchive* archive = FindArchive(spritesheetPath))
+		{
+			if (auto data = archive->Read(spritesheetPath, buffer))
+				return Spritesheet::LoadFromMemory(data->data(), data->size());
+		}
+
+		return Spritesheet::LoadFromFile(spritesheetPath);
+	}
+
+	Surface ResourceManager::LoadSurface(const std::string& filepath) const
+	{
+		std::vector<std::uint8_t> buffer;
+		if (const AssetArchive* archive = FindArchive(filepath))
+		{
+			if (auto data = archive->Read(filepath, buffer))
+				return Surface::LoadFromMemory(data->data(), data->size());
+		}
+
+		return Surface::LoadFromFile(filepath);
+	}
+
+	ResourceManager::DecodedModel ResourceManager::DecodeModel(const std::string& modelPath) const
+	{
+		DecodedModel decodedModel;
+
+		// Le ResourceManager n'est pas utilisable depuis un thread de chargement : on retient le chemin de la texture
+		// et on la dcode ici, elle sera envoye au GPU lors de la finalisation
+		auto textureResolver = [&](const std::string& path) -> std::shared_ptr<Texture>
+		{
+			decodedModel.texturePath = path;
+			try
+			{
+				decodedModel.textureSurface = std::make_shared<Surface>(LoadSurface(path));
+			}
+			catch (const std::exception& e)
+			{
+				fmt::print(fg(fmt::color::red), "failed to load {0}: {1}\n", path, e.what());
+			}
+
+			return nullptr;
+		};
+
+		try
+		{
+			Model model = LoadModel(modelPath, textureResolver);
+			if (model.IsValid())
+				decodedModel.model = std::make_shared<Model>(std::move(model));
+		}
+		catch (const std::exception& e)
+		{
+			fmt::print(fg(fmt::color::red), "failed to load {0}: {1}\n", modelPath, e.what());
+		}
+
+		return decodedModel;
+	}
+
+	Model ResourceManager::FinalizeModel(const std::string& modelPath, const DecodedModel& decodedModel)
+	{
+		std::shared_ptr<Texture> texture;
+		if (std::shared_ptr<Texture>* cachedTexture = FindCached(m_textures, decodedModel.texturePath))
+			texture = *cachedTexture;
+		else if (decodedModel.textureSurface)
+			texture = StoreCached(m_textures, decodedModel.texturePath, CreateTexture(decodedModel.texturePath, *decodedModel.textureSurface));
+		else
+			texture = GetMissingTexture();
+
+		// Le modle doit tre reconstruit avec sa texture pour que ses UV soient places dans la bonne rgion d'atlas
+		return Model(std::move(texture), decodedModel.model->GetVertices(), decodedModel.model->GetIndices(), modelPath);
+	}
+
+	std::size_t ResourceManager::DecodedModel::GetUploadSize() const
+	{
+		if (!textureSurface)
+			return 0;
+
+		return std::size_t(textureSurface->GetPitch()) * textureSurface->GetHeight();
+	}
+
+	AssetHandle<Model> ResourceManager::LoadModelAsync(const std::string& modelPath)
+	{
+		using State = AssetHandle<Model>::State;
+
+		auto pendingIt = m_pendingModels.find(modelPath);
+		if (pendingIt != m_pendingModels.end())
+			return AssetHandle<Model>(pendingIt->second);
+
+		std::shared_ptr<State> state = std::make_shared<State>();
+		state->placeholder = GetMissingModel();
+
+		if (std::shared_ptr<Model>* model = FindCached(m_models, modelPath))
+		{
+			state->asset = *model;
+			state->status = (*model == m_missingModel) ? AssetStatus::Failed : AssetStatus::Loaded;
+			return AssetHandle<Model>(std::move(state));
+		}
+
+		m_pendingModels.emplace(modelPath, state);
+
+		m_loaderPool->Submit([this, modelPath]
+		{
+			DecodedModel decodedModel = DecodeModel(modelPath);
+			std::size_t uploadSize = decodedModel.GetUploadSize();
+
+			PushCompletedLoad([this, modelPath, decodedModel = std::move(decodedModel)]
+			{
+				auto stateIt = m_pendingModels.find(modelPath);
+				if (stateIt == m_pendingModels.end())
+					return;
+
+				std::shared_ptr<State> state = std::move(stateIt->second);
+				m_pendingModels.erase(stateIt);
+
+				// Un chargement synchrone a pu avoir lieu entre-temps
+				if (std::shared_ptr<Model>* cachedModel = FindCached(m_models, modelPath))
+				{
+					state->asset = *cachedModel;
+					state->status = (*cachedModel == m_missingModel) ? AssetStatus::Failed : AssetStatus::Loaded;
+					return;
+				}
+
+				if (!decodedModel.model)
+				{
+					state->asset = StoreCached(m_models, modelPath, GetMissingModel());
+					state->status = AssetStatus::Failed;
+					return;
+				}
+
+				state->asset = StoreCached(m_models, modelPath, std::make_shared<Model>(FinalizeModel(modelPath, decodedModel)));
+				state->status = AssetStatus::Loaded;
+			}, uploadSize);
+		});
+
+		return AssetHandle<Model>(std::move(state));
+	}
+
+	AssetHandle<Spritesheet> ResourceManager::LoadSpritesheetAsync(const std::string& spritesheetPath)
+	{
+		using State = AssetHandle<Spritesheet>::State;
+
+		auto pendingIt = m_pendingSpritesheets.find(spritesheetPath);
+		if (pendingIt != m_pendingSpritesheets.end())
+			return AssetHandle<Spritesheet>(pendingIt->second);
+
+		std::shared_ptr<State> state = std::make_shared<State>();
+		state->placeholder = GetMissingSpritesheet();
+
+		if (std::shared_ptr<Spritesheet>* spritesheet = FindCached(m_spritesheets, spritesheetPath))
+		{
+			state->asset = *spritesheet;
+			state->status = (*spritesheet == m_missingSpritesheet) ? AssetStatus::Failed : AssetStatus::Loaded;
+			return AssetHandle<Spritesheet>(std::move(state));
+		}
+
+		m_pendingSpritesheets.emplace(spritesheetPath, state);
+
+		m_loaderPool->Submit([this, spritesheetPath]
+		{
+			std::shared_ptr<Spritesheet> spritesheet;
+			try
+			{
+				spritesheet = std::make_shared<Spritesheet>(LoadSpritesheet(spritesheetPath));
+			}
+			catch (const std::exception& e)
+			{
+				fmt::print(fg(fmt::color::red), "failed to load {0}: {1}\n", spritesheetPath, e.what());
+			}
+
+			PushCompletedLoad([this, spritesheetPath, spritesheet]
+			{
+				auto stateIt = m_pendingSpritesheets.find(spritesheetPath);
+				if (stateIt == m_pendingSpritesheets.end())
+					return;
+
+				std::shared_ptr<State> state = std::move(stateIt->second);
+				m_pendingSpritesheets.erase(stateIt);
+
+				if (std::shared_ptr<Spritesheet>* cachedSpritesheet = FindCached(m_spritesheets, spritesheetPath))
+					state->asset = *cachedSpritesheet;
+				else
+					state->asset = StoreCached(m_spritesheets, spritesheetPath, (spritesheet) ? spritesheet : GetMissingSpritesheet());
+
+				state->status = (state->asset == m_missingSpritesheet) ? AssetStatus::Failed : AssetStatus::Loaded;
+			}, 0);
+		});
+
+		return AssetHandle<Spritesheet>(std::move(state));
+	}
+
+	AssetHandle<Texture> ResourceManager::LoadTextureAsync(const std::string& filepath)
+	{
+		using State = AssetHandle<Texture>::State;
+
+		auto pendingIt = m_pendingTextures.find(filepath);
+		if (pendingIt != m_pendingTextures.end())
+			return AssetHandle<Texture>(pendingIt->second);
+
+		std::shared_ptr<State> state = std::make_shared<State>();
+		state->placeholder = GetMissingTexture();
+
+		// Les textures dj charges ou prsentes dans l'atlas pr-construit sont disponibles immdiatement
+		if (std::shared_ptr<Texture>* texture = FindCached(m_textures, filepath))
+			state->asset = *texture;
+		else if (m_prebuiltAtlas)
+		{
+			if (std::shared_ptr<Texture> region = m_prebuiltAtlas->Find(filepath))
+				state->asset = StoreCached(m_textures, filepath, std::move(region));
+		}
+
+		if (state->asset)
+		{
+			state->status = AssetStatus::Loaded;
+			return AssetHandle<Texture>(std::move(state));
+		}
+
+		m_pendingTextures.emplace(filepath, state);
+
+		m_loaderPool->Submit([this, filepath]
+		{
+			std::shared_ptr<Surface> surface;
+			try
+			{
+				surface = std::make_shared<Surface>(LoadSurface(filepath));
+			}
+			catch (const std::exception& e)
+			{
+				fmt::print(fg(fmt::color::red), "failed to load {0}: {1}\n", filepath, e.what());
+			}
+
+			std::size_t uploadSize = (surface) ? std::size_t(surface->GetPitch()) * surface->GetHeight() : 0;
+
+			PushCompletedLoad([this, filepath, surface]
+			{
+				auto stateIt = m_pendingTextures.find(filepath);
+				if (stateIt == m_pendingTextures.end())
+					return;
+
+				std::shared_ptr<State> state = std::move(stateIt->second);
+				m_pendingTextures.erase(stateIt);
+
+				if (std::shared_ptr<Texture>* cachedTexture = FindCached(m_textures, filepath))
+					state->asset = *cachedTexture;
+				else if (surface)
+					state->asset = StoreCached(m_textures, filepath, CreateTexture(filepath, *surface));
+				else
+				{
+					// Comme GetTexture, on ne met pas les checs en cache afin de pouvoir ressayer plus tard
+					state->status = AssetStatus::Failed;
+					return;
+				}
+
+				state->status = AssetStatus::Loaded;
+			}, uploadSize);
+		});
+
+		return AssetHandle<Texture>(std::move(state));
+	}
+
+	std::size_t ResourceManager::GetMemoryBudget() const
+	{
+		return m_memoryBudget;
+	}
+
+	ResourceManager::MemoryStats ResourceManager::GetMemoryStats() const
+	{
+		MemoryStats stats;
+		for (const auto& [key, entry] : m_fonts)
+			stats.fontBytes += entry.asset->GetMemorySize();
+
+		for (const auto& [key, entry] : m_models)
+			stats.modelBytes += entry.asset->GetMemorySize();
+
+		for (const auto& [key, entry] : m_spritesheets)
+			stats.spritesheetBytes += entry.asset->GetMemorySize();
+
+		// Les rgions d'atlas ne comptent pas, leurs pages sont comptes une seule fois ici
+		for (const auto& [key, entry] : m_textures)
+			stats.textureBytes += entry.asset->GetMemorySize();
+
+		stats.textureBytes += m_textureAtlas->GetMemorySize();
+		if (m_prebuiltAtlas)
+			stats.pinnedBytes += m_prebuiltAtlas->GetMemorySize();
+
+		return stats;
+	}
+
+	std::size_t ResourceManager::GetPendingLoadCount() const
+	{
+		return m_pendingModels.size() + m_pendingSpritesheets.size() + m_pendingTextures.size();
+	}
+
+	std::size_t ResourceManager::GetUploadBudget() const
+	{
+		return m_uploadBudget;
+	}
+
+	void ResourceManager::PushCompletedLoad(std::function<void()> finalize, std::size_t uploadSize)
+	{
+		std::lock_guard lock(m_completedLoadsMutex);
+		m_completedLoads.push_back(CompletedLoad{ std::move(finalize), uploadSize });
+	}
+
+	void ResourceManager::SetMemoryBudget(std::size_t bytes)
+	{
+		m_memoryBudget = bytes;
+	}
+
+	void ResourceManager::SetUploadBudget(std::size_t bytesPerFrame)
+	{
+		m_uploadBudget = bytesPerFrame;
+	}
+
+	void ResourceManager::Update()
+	{
+		m_currentFrame++;
+
+		if (m_fileWatcher)
+		{
+			for (const std::string& filepath : m_fileWatcher->Poll())
+				ReloadFile(filepath);
+		}
+
+		bool hasFinalized = false;
+		std::size_t uploadedSize = 0;
+		for (;;)
+		{
+			CompletedLoad completedLoad;
+			{
+				std::lock_guard lock(m_completedLoadsMutex);
+				if (m_completedLoads.empty())
+					break;
+
+				// On finalise toujours au moins un chargement par frame, mme s'il dpasse le budget  lui seul
+				CompletedLoad& nextLoad = m_completedLoads.front();
+				if (hasFinalized && uploadedSize + nextLoad.uploadSize > m_uploadBudget)
+					break;
+
+				completedLoad = std::move(nextLoad);
+				m_completedLoads.pop_front();
+			}
+
+			completedLoad.finalize();
+			uploadedSize += completedLoad.uploadSize;
+			hasFinalized = true;
+		}
+
+		if (m_memoryBudget == 0)
+			return;
+
+		// Une ressource encore rfrence est en cours d'utilisation : l'ordre LRU ne doit compter qu' partir de sa libration
+		auto markReferencedAsUsed = [&](auto& cache)
+		{
+			for (auto& [key, entry] : cache)
+			{
+				if (IsReferenced(entry.asset))
+					entry.lastUsedFrame = m_currentFrame;
+			}
+		};
+
+		markReferencedAsUsed(m_fonts);
+		markReferencedAsUsed(m_models);
+		markReferencedAsUsed(m_prefabs);
+		markReferencedAsUsed(m_spritesheets);
+		markReferencedAsUsed(m_textures);
+
+		std::size_t residentBytes = GetMemoryStats().GetEvictableTotal();
+		if (residentBytes > m_memoryBudget)
+			EvictUnused(residentBytes - m_memoryBudget);
+	}
+
+	void ResourceManager::EnableHotReload(bool enable)
+	{
+		if (!enable)
+		{
+			m_fileWatcher.reset();
+			return;
+		}
+
+		if (m_fileWatcher)
+			return;
+
+		m_fileWatcher = std::make_unique<FileWatcher>();
+		for (const auto& [key, entry] : m_models)
+			m_fileWatcher->Watch(key);
+
+		for (const auto& [key, entry] : m_prefabs)
+			m_fileWatcher->Watch(key);
+
+		for (const auto& [key, entry] : m_spritesheets)
+			m_fileWatcher->Watch(key);
+
+		for (const auto& [key, entry] : m_textures)
+			m_fileWatcher->Watch(key);
+
+		for (const auto& [key, entry] : m_fonts)
+			m_fileWatcher->Watch(key.substr(0, key.find_last_of(';')));
+	}
+
+	bool ResourceManager::IsHotReloadEnabled() const
+	{
+		return m_fileWatcher != nullptr;
+	}
+
+	void ResourceManager::RebuildModelsUsingTexture(const std::shared_ptr<Texture>& texture)
+	{
+		// Les UV des modles sont exprimes dans la page d'atlas de leur texture, qui a pu changer
+		for (auto& [key, entry] : m_models)
+		{
+			Model& model = *entry.asset;
+			if (model.GetTexture() == texture.get())
+				model = Model(texture, model.GetVertices(), model.GetIndices(), model.GetFilepath());
+		}
+	}
+
+	void ResourceManager::ReloadFile(const std::string& filepath)
+	{
+		// Un mme fichier peut tre utilis par plusieurs catgories (et par plusieurs tailles de police)
+		fmt::print("Reloading {0}...\n", filepath);
+
+		if (m_models.contains(filepath))
+			ReloadModel(filepath);
+
+		if (m_prefabs.contains(filepath))
+			ReloadPrefab(filepath);
+
+		if (m_spritesheets.contains(filepath))
+			ReloadSpritesheet(filepath);
+
+		if (m_textures.contains(filepath))
+			ReloadTexture(filepath);
+
+		ReloadFonts(filepath);
+	}
+
+	void ResourceManager::ReloadFonts(const std::string& fontPath)
+	{
+		// FreeType ne permet pas d'ouvrir une police sur un autre thread, les polices sont donc recharges ici.
+		// Les textes existants gardent les glyphes de l'ancienne version jusqu' leur prochaine reconstruction.
+		std::string keyPrefix = fontPath + ";";
+		for (auto& [key, entry] : m_fonts)
+		{
+			if (!key.starts_with(keyPrefix))
+				continue;
+
+			try
+			{
+				int size = std::stoi(key.substr(keyPrefix.size()));
+				*entry.asset = OpenFont(fontPath, size);
+			}
+			catch (const std::exception& e)
+			{
+				fmt::print(fg(fmt::color::red), "failed to reload {0}: {1}\n", fontPath, e.what());
+			}
+		}
+	}
+
+	void ResourceManager::ReloadModel(const std::string& modelPath)
+	{
+		m_loaderPool->Submit([this, modelPath]
+		{
+			DecodedModel decodedModel = DecodeModel(modelPath);
+			std::size_t uploadSize = decodedModel.GetUploadSize();
+
+			PushCompletedLoad([this, modelPath, decodedModel = std::move(decodedModel)]
+			{
+				// En cas d'erreur (fichier en cours d'criture...) on garde l'ancienne version
+				auto it = m_models.find(modelPath);
+				if (it == m_models.end() || !decodedModel.model)
+					return;
+
+				// Le modle "manquant" est partag entre tous les chemins, il ne doit pas tre modifi
+				std::shared_ptr<Model>& model = it->second.asset;
+				if (model == m_missingModel)
+					model = std::make_shared<Model>(FinalizeModel(modelPath, decodedModel));
+				else
+					*model = FinalizeModel(modelPath, decodedModel);
+			}, uploadSize);
+		});
+	}
+
+	void ResourceManager::ReloadPrefab(const std::string& prefabPath)
+	{
+		// Les dsrialiseurs peuvent demander d'autres ressources (textures, spritesheets) : rechargement sur le thread principal.
+		// Les entits dj instancies ne changent pas, seules les prochaines instances utilisent la nouvelle version.
+		std::shared_ptr<Prefab>& prefab = m_prefabs[prefabPath].asset;
+		try
+		{
+			*prefab = LoadPrefab(prefabPath, prefab->GetComponentRegistry());
+		}
+		catch (const std::exception& e)
+		{
+			fmt::print(fg(fmt::color::red), "failed to reload {0}: {1}\n", prefabPath, e.what());
+		}
+	}
+
+	void ResourceManager::ReloadSpritesheet(const std::string& spritesheetPath)
+	{
+		m_loaderPool->Submit([this, spritesheetPath]
+		{
+			std::shared_ptr<Spritesheet> spritesheet;
+			try
+			{
+				spritesheet = std::make_shared<Spritesheet>(LoadSpritesheet(spritesheetPath));
+			}
+			catch (const std::exception& e)
+			{
+				fmt::print(fg(fmt::color::red), "failed to reload {0}: {1}\n", spritesheetPath, e.what());
+				return;
+			}
+
+			PushCompletedLoad([this, spritesheetPath, spritesheet]
+			{
+				auto it = m_spritesheets.find(spritesheetPath);
+				if (it == m_spritesheets.end())
+					return;
+
+				std::shared_ptr<Spritesheet>& cachedSpritesheet = it->second.asset;
+				if (cachedSpritesheet == m_missingSpritesheet)
+					cachedSpritesheet = spritesheet;
+				else
+					*cachedSpritesheet = std::move(*spritesheet);
+			}, 0);
+		});
+	}
+
+	void ResourceManager::ReloadTexture(const std::string& filepath)
+	{
+		m_loaderPool->Submit([this, filepath]
+		{
+			std::shared_ptr<Surface> surface;
+			try
+			{
+				surface = std::make_shared<Surface>(LoadSurface(filepath));
+			}
+			catch (const std::exception& e)
+			{
+				fmt::print(fg(fmt::color::red), "failed to reload {0}: {1}\n", filepath, e.what());
+				return;
+			}
+
+			std::size_t uploadSize = std::size_t(surface->GetPitch()) * surface->GetHeight();
+
+			PushCompletedLoad([this, filepath, surface]
+			{
+				auto it = m_textures.find(filepath);
+				if (it == m_textures.end())
+					return;
+
+				std::shared_ptr<Texture> texture = it->second.asset;
+
+				// Une rgion d'atlas est mise  jour dans sa page (ou dplace si sa taille a chang),
+				// une texture isole est simplement recre : dans les deux cas l'objet Texture reste le mme
+				bool isReloaded = false;
+				if (texture->IsAtlasRegion())
+				{
+					isReloaded = m_textureAtlas->Reload(filepath, *surface);
+					if (!isReloaded && m_prebuiltAtlas)
+						isReloaded = m_prebuiltAtlas->Reload(filepath, *surface);
+				}
+
+				if (!isReloaded)
+				{
+					Texture newTexture = Texture::CreateFromSurface(*m_renderer, *surface);
+					newTexture.m_path = filepath;
+
+					*texture = std::move(newTexture);
+				}
+
+				RebuildModelsUsingTexture(texture);
+			}, uploadSize);
+		});
+	}
 }
@@ -0,0 +1,338 @@
+#include <SuperCoco/SceneSerializer.hpp>
+#include <SuperCoco/BinarySerializer.hpp>
+#include <SuperCoco/ComponentRegistry.hpp>
+#include <SuperCoco/MappedFile.hpp>
+#include <SuperCoco/ThreadPool.hpp>
+#include <SuperCoco/Transform.hpp>
+#include <fmt/color.h>
+#include <fmt/core.h>
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <fstream>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace Sce
+{
+	constexpr std::array<char, 4> SceneMagic = { 'S', 'C', 'S', 'N' };
+	constexpr std::uint32_t SceneVersion = 1;
+
+	namespace
+	{
+		enum class ColumnEncoding : std::uint8_t
+		{
+			Binary = 0, //< ComponentRegistry::Entry::serializeColumn
+			Cbor = 1 //< ComponentRegistry::Entry::serialize, une valeur CBOR par entité
+		};
+
+		struct Column
+		{
+			const ComponentRegistry::Entry* entry;
+			ColumnEncoding encoding;
+			std::vector<std::uint32_t> entityIndices;
+			std::span<const std::uint8_t> data;
+
+			ComponentRegistry::ColumnInserter inserter;
+			std::exception_ptr error;
+		};
+
+		struct Hierarchy
+		{
+			std::uint32_t parentIndex;
+			std::uint32_t childIndex;
+		};
+	}
+
+	bool SceneSerializer::LoadBinary(entt::registry& registry, const ComponentRegistry& componentRegistry, const std::string& filepath, bool replaceExisting)
+	{
+		std::vector<entt::entity> entities;
+		std::vector<Hierarchy> hierarchies;
+		std::vector<Column> columns;
+
+		// Le fichier est projeté en mémoire : les colonnes sont décodées directement depuis la projection
+		std::optional<MappedFile> mappedFile;
+		try
+		{
+			mappedFile.emplace(MappedFile::Open(filepath));
+
+			BinaryReader reader(mappedFile->GetData());
+
+			std::array<char, 4> magic = reader.Read<std::array<char, 4>>();
+			if (magic != SceneMagic)
+				throw std::runtime_error("not a binary scene");
+
+			std::uint32_t version = reader.Read<std::uint32_t>();
+			if (version > SceneVersion)
+				throw std::runtime_error(fmt::format("unknown file version {}", version));
+
+			std::uint32_t entityCount = reader.Read<std::uint32_t>();
+			std::uint32_t hierarchyCount = reader.Read<std::uint32_t>();
+			std::uint32_t columnCount = reader.Read<std::uint32_t>();
+
+			// Les compteurs sont vérifiés avant d'allouer quoi que ce soit : un fichier tronqué ou corrompu
+			// ne doit pas pouvoir réclamer des gigaoctets de mémoire
+			if (entityCount > entt::entt_traits<entt::entity>::entity_mask)
+				throw std::runtime_error("too many entities");
+
+			if (hierarchyCount > reader.GetRemainingSize() / sizeof(Hierarchy))
+				throw std::runtime_error("truncated hierarchy data");
+
+			// Chaque colonne occupe au moins trois octets (longueur de l'identifiant, encodage, nombre d'entités)
+			if (columnCount > reader.GetRemainingSize() / 3)
+				throw std::runtime_error("truncated column data");
+
+			hierarchies.resize(hierarchyCount);
+			reader.ReadSpan(std::span<Hierarchy>(hierarchies));
+
+			for (const Hierarchy& hierarchy : hierarchies)
+			{
+				if (hierarchy.parentIndex >= entityCount || hierarchy.childIndex >= entityCount)
+					throw std::runtime_error("invalid entity index in hierarchy");
+			}
+
+			columns.reserve(columnCount);
+			for (std::uint32_t i = 0; i < columnCount; ++i)
+			{
+				std::string componentId = reader.ReadString();
+				ColumnEncoding encoding = static_cast<ColumnEncoding>(reader.Read<std::uint8_t>());
+
+				std::uint64_t indexCount = reader.ReadVarUInt();
+				if (indexCount > reader.GetRemainingSize() / sizeof(std::uint32_t))
+					throw std::runtime_error("truncated entity indices in component " + componentId);
+
+				std::vector<std::uint32_t> entityIndices(indexCount);
+				reader.ReadSpan(std::span<std::uint32_t>(entityIndices));
+
+				std::uint64_t dataSize = reader.ReadVarUInt();
+				std::span<const std::uint8_t> data = mappedFile->GetData().subspan(reader.GetPosition());
+				reader.Skip(dataSize);
+				data = data.first(dataSize);
+
+				for (std::uint32_t entityIndex : entityIndices)
+				{
+					if (entityIndex >= entityCount)
+						throw std::runtime_error("invalid entity index in component " + componentId);
+				}
+
+				const ComponentRegistry::Entry* entry = componentRegistry.FindComponent(componentId);
+				if (!entry || (encoding == ColumnEncoding::Binary && !entry->decodeColumn) || (encoding == ColumnEncoding::Cbor && !entry->unserialize))
+				{
+					fmt::print(fg(fmt::color::yellow), "{}: ignoring unknown component {}\n", filepath, componentId);
+					continue;
+				}
+
+				columns.push_back(Column{ entry, encoding, std::move(entityIndices), data, {}, {} });
+			}
+
+			entities.resize(entityCount);
+		}
+		catch (const std::exception& e)
+		{
+			fmt::print(fg(fmt::color::red), "failed to load {}: {}\n", filepath, e.what());
+			return false;
+		}
+
+		// Chaque colonne (ou morceau de colonne) est décodée sur un thread, sans toucher au registre qui n'est pas thread-safe
+		if (!columns.empty())
+		{
+			ThreadPool decodePool(std::min<std::size_t>(columns.size(), std::max(std::thread::hardware_concurrency(), 1u)));
+			for (Column& column : columns)
+			{
+				decodePool.Submit([&column]
+				{
+					try
+					{
+						BinaryReader columnReader(column.data);
+						if (column.encoding == ColumnEncoding::Binary)
+						{
+							column.inserter = column.entry->decodeColumn(columnReader, column.entityIndices.size());
+							return;
+						}
+
+						std::vector<nlohmann::json> docs;
+						docs.reserve(column.entityIndices.size());
+						for (std::size_t i = 0; i < column.entityIndices.size(); ++i)
+						{
+							std::vector<std::uint8_t> cbor(columnReader.ReadVarUInt());
+							columnReader.ReadSpan(std::span<std::uint8_t>(cbor));
+							docs.push_back(nlohmann::json::from_cbor(cbor));
+						}
+
+						column.inserter = [unserialize = column.entry->unserialize, docs = std::move(docs)](entt::registry& registry, std::span<const entt::entity> entities)
+						{
+							for (std::size_t i = 0; i < entities.size(); ++i)
+								unserialize(entt::handle(registry, entities[i]), docs[i]);
+						};
+					}
+					catch (const std::exception&)
+					{
+						column.error = std::current_exception();
+					}
+				});
+			}
+		} //< le destructeur du ThreadPool attend la fin des tâches
+
+		for (const Column& column : columns)
+		{
+			if (!column.error)
+				continue;
+
+			try
+			{
+				std::rethrow_exception(column.error);
+			}
+			catch (const std::exception& e)
+			{
+				fmt::print(fg(fmt::color::red), "failed to load {}: component {}: {}\n", filepath, column.entry->id, e.what());
+				return false;
+			}
+		}
+
+		// Le fichier est entièrement décodé, le registre peut être modifié sans risquer d'y laisser une scène à moitié chargée
+		// (clear plutôt qu'une réaffectation pour conserver les signaux connectés par les systèmes)
+		if (replaceExisting)
+			registry.clear();
+
+		// Création et insertion en bloc, sur le thread appelant
+		registry.create(entities.begin(), entities.end());
+
+		std::vector<entt::entity> columnEntities;
+		for (const Column& column : columns)
+		{
+			columnEntities.resize(column.entityIndices.size());
+			for (std::size_t i = 0; i < column.entityIndices.size(); ++i)
+				columnEntities[i] = entities[column.entityIndices[i]];
+
+			column.inserter(registry, columnEntities);
+		}
+
+		for (const Hierarchy& hierarchy : hierarchies)
+		{
+			Transform* parentTransform = registry.try_get<Transform>(entities[hierarchy.parentIndex]);
+			Transform* childTransform = registry.try_get<Transform>(entities[hierarchy.childIndex]);
+			if (parentTransform && childTransform)
+				childTransform->SetParent(parentTransform);
+		}
+
+		return true;
+	}
+
+	bool SceneSerializer::SaveBinary(entt::registry& registry, const ComponentRegistry& componentRegistry, const std::string& filepath)
+	{
+		std::vector<entt::entity> entities;
+		std::unordered_map<entt::entity, std::uint32_t> entityIndices;
+		for (auto [entity] : registry.storage<entt::entity>().each())
+		{
+			std::uint32_t entityIndex = static_cast<std::uint32_t>(entities.size());
+			entities.push_back(entity);
+			entityIndices.emplace(entity, entityIndex);
+		}
+
+		std::vector<Hierarchy> hierarchies;
+		for (auto&& [entity, transform] : registry.view<Transform>().each())
+		{
+			entt::entity parentEntity = transform.GetParentEntity();
+			if (parentEntity != entt::null)
+				hierarchies.push_back({ entityIndices[parentEntity], entityIndices[entity] });
+		}
+
+		struct ColumnData
+		{
+			std::string componentId;
+			ColumnEncoding encoding;
+			std::vector<std::uint32_t> entityIndices;
+			std::vector<std::uint8_t> data;
+		};
+
+		std::vector<ColumnData> columns;
+		std::vector<std::uint32_t> componentIndices;
+		std::vector<entt::entity> componentEntities;
+		componentRegistry.ForEachComponent([&](const ComponentRegistry::Entry& entry)
+		{
+			if (!entry.hasComponent || (!entry.serializeColumn && !entry.serialize))
+				return;
+
+			componentIndices.clear();
+			componentEntities.clear();
+			for (std::uint32_t entityIndex = 0; entityIndex < entities.size(); ++entityIndex)
+			{
+				if (entry.hasComponent(entt::handle(registry, entities[entityIndex])))
+				{
+					componentIndices.push_back(entityIndex);
+					componentEntities.push_back(entities[entityIndex]);
+				}
+			}
+
+			// Une colonne est décodée par une seule tâche au chargement : les grandes colonnes sont découpées
+			// pour que quelques composants très répandus ne chargent pas la scène presque séquentiellement
+			for (std::size_t first = 0; first < componentEntities.size(); first += MaxColumnRows)
+			{
+				std::size_t rowCount = std::min(MaxColumnRows, componentEntities.size() - first);
+				std::span<const entt::entity> columnEntities(componentEntities.data() + first, rowCount);
+
+				ColumnData column;
+				column.componentId = entry.id;
+				column.entityIndices.assign(componentIndices.begin() + first, componentIndices.begin() + first + rowCount);
+
+				BinaryWriter columnWriter;
+				if (entry.serializeColumn)
+				{
+					column.encoding = ColumnEncoding::Binary;
+					entry.serializeColumn(registry, columnEntities, columnWriter);
+				}
+				else
+				{
+					column.encoding = ColumnEncoding::Cbor;
+					for (entt::entity entity : columnEntities)
+					{
+						std::vector<std::uint8_t> cbor = nlohmann::json::to_cbor(entry.serialize(entt::handle(registry, entity)));
+						columnWriter.WriteVarUInt(cbor.size());
+						columnWriter.WriteSpan(std::span<const std::uint8_t>(cbor));
+					}
+				}
+
+				column.data = columnWriter.TakeData();
+				columns.push_back(std::move(column));
+			}
+		});
+
+		std::ofstream fileStream(filepath, std::ios::binary | std::ios::trunc);
+		if (!fileStream)
+		{
+			fmt::print(fg(fmt::color::red), "failed to open {}\n", filepath);
+			return false;
+		}
+
+		try
+		{
+			BinaryWriter writer(fileStream);
+			writer.Write(SceneMagic);
+			writer.Write(SceneVersion);
+			writer.Write(static_cast<std::uint32_t>(entities.size()));
+			writer.Write(static_cast<std::uint32_t>(hierarchies.size()));
+			writer.Write(static_cast<std::uint32_t>(columns.size()));
+			writer.WriteSpan(std::span<const Hierarchy>(hierarchies));
+
+			for (const ColumnData& column : columns)
+			{
+				writer.WriteString(column.componentId);
+				writer.Write(static_cast<std::uint8_t>(column.encoding));
+				writer.WriteVarUInt(column.entityIndices.size());
+				writer.WriteSpan(std::span<const std::uint32_t>(column.entityIndices));
+				writer.WriteVarUInt(column.data.size());
+				writer.WriteSpan(std::span<const std::uint8_t>(column.data));
+			}
+
+			writer.Flush();
+		}
+		catch (const std::exception& e)
+		{
+			fmt::print(fg(fmt::color::red), "failed to save {}: {}\n", filepath, e.what());
+			return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,119 @@
+#include <SuperCoco/SkylinePacker.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace Sce
+{
+	SkylinePacker::SkylinePacker(int width, int height) :
+	m_usedArea(0),
+	m_height(height),
+	m_width(width)
+	{
+		Reset();
+	}
+
+	float SkylinePacker::GetOccupancy() const
+	{
+		return static_cast<float>(m_usedArea) / (static_cast<float>(m_width) * m_height);
+	}
+
+	std::optional<SDL_Rect> SkylinePacker::Insert(int width, int height)
+	{
+		if (width <= 0 || height <= 0)
+			return std::nullopt;
+
+		std::size_t bestIndex = m_skyline.size();
+		int bestTop = std::numeric_limits<int>::max();
+		int bestY = 0;
+
+		for (std::size_t i = 0; i < m_skyline.size(); ++i)
+		{
+			std::optional<int> y = Fit(i, width, height);
+			if (!y)
+				continue;
+
+			// On privilégie le bord supérieur le plus bas, puis la position la plus à gauche (parcours dans l'ordre des x)
+			if (*y + height < bestTop)
+			{
+				bestIndex = i;
+				bestTop = *y + height;
+				bestY = *y;
+			}
+		}
+
+		if (bestIndex == m_skyline.size())
+			return std::nullopt;
+
+		SDL_Rect rect{ m_skyline[bestIndex].x, bestY, width, height };
+
+		// Le nouveau segment recouvre le début de la ligne d'horizon à partir de bestIndex
+		m_skyline.insert(m_skyline.begin() + bestIndex, Segment{ rect.x, rect.y + height, width });
+
+		for (std::size_t i = bestIndex + 1; i < m_skyline.size();)
+		{
+			const Segment& previous = m_skyline[i - 1];
+			Segment& segment = m_skyline[i];
+
+			int previousEnd = previous.x + previous.width;
+			if (segment.x >= previousEnd)
+				break;
+
+			int overlap = previousEnd - segment.x;
+			if (segment.width <= overlap)
+			{
+				m_skyline.erase(m_skyline.begin() + i);
+				continue;
+			}
+
+			segment.x += overlap;
+			segment.width -= overlap;
+			break;
+		}
+
+		// Fusion des segments voisins de même hauteur
+		for (std::size_t i = 1; i < m_skyline.size();)
+		{
+			if (m_skyline[i - 1].y == m_skyline[i].y)
+			{
+				m_skyline[i - 1].width += m_skyline[i].width;
+				m_skyline.erase(m_skyline.begin() + i);
+			}
+			else
+				++i;
+		}
+
+		m_usedArea += static_cast<long long>(width) * height;
+		return rect;
+	}
+
+	void SkylinePacker::Reset()
+	{
+		m_skyline.clear();
+		m_skyline.push_back(Segment{ 0, 0, m_width });
+		m_usedArea = 0;
+	}
+
+	std::optional<int> SkylinePacker::Fit(std::size_t segmentIndex, int width, int height) const
+	{
+		int x = m_skyline[segmentIndex].x;
+		if (x + width > m_width)
+			return std::nullopt;
+
+		// Le rectangle repose sur le plus haut des segments qu'il recouvre
+		int y = 0;
+		int remainingWidth = width;
+		for (std::size_t i = segmentIndex; remainingWidth > 0; ++i)
+		{
+			if (i >= m_skyline.size())
+				return std::nullopt;
+
+			y = std::max(y, m_skyline[i].y);
+			if (y + height > m_height)
+				return std::nullopt;
+
+			remainingWidth -= m_skyline[i].width;
+		}
+
+		return y;
+	}
+}
@@ -0,0 +1,348 @@
+#include <SuperCoco/SpatialHash.hpp>
+#include <SuperCoco/Affine2.hpp>
+#include <SuperCoco/Vector2.hpp>
+#include <fmt/color.h>
+#include <fmt/core.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace Sce
+{
+	// Au-delà de ce nombre de cellules couvertes, on évite de dupliquer l'entité partout et on la range dans la liste des grandes entités
+	constexpr int MaxCellsPerItem = 64;
+
+	namespace
+	{
+		// Les coordonnées de cellule sont bornées (avec une marge pour que les boucles « <= max » ne débordent pas) :
+		// convertir en int un flottant hors de la plage de int est un comportement indéfini
+		int ToCellCoord(float value)
+		{
+			constexpr double MinCoord = std::numeric_limits<int>::min() + 1.0;
+			constexpr double MaxCoord = std::numeric_limits<int>::max() - 1.0;
+
+			if (std::isnan(value))
+				return 0;
+
+			return static_cast<int>(std::clamp(std::floor(static_cast<double>(value)), MinCoord, MaxCoord));
+		}
+
+		bool IsFinite(const SDL_FRect& rect)
+		{
+			return std::isfinite(rect.x) && std::isfinite(rect.y) && std::isfinite(rect.w) && std::isfinite(rect.h);
+		}
+	}
+
+	SpatialHash::SpatialHash(float cellSize) :
+	m_cellSize(cellSize),
+	m_invCellSize(1.f / cellSize),
+	m_queryStamp(0)
+	{
+		assert(cellSize > 0.f);
+	}
+
+	void SpatialHash::Clear()
+	{
+		m_cells.clear();
+		m_entityToSlot.clear();
+		m_items.clear();
+		m_freeSlots.clear();
+		m_largeItems.clear();
+	}
+
+	bool SpatialHash::Contains(entt::entity entity) const
+	{
+		return m_entityToSlot.find(entity) != m_entityToSlot.end();
+	}
+
+	const SDL_FRect& SpatialHash::GetBounds(entt::entity entity) const
+	{
+		auto it = m_entityToSlot.find(entity);
+		assert(it != m_entityToSlot.end());
+
+		return m_items[it->second].bounds;
+	}
+
+	float SpatialHash::GetCellSize() const
+	{
+		return m_cellSize;
+	}
+
+	int SpatialHash::GetLayer(entt::entity entity) const
+	{
+		auto it = m_entityToSlot.find(entity);
+		assert(it != m_entityToSlot.end());
+
+		return m_items[it->second].layer;
+	}
+
+	std::size_t SpatialHash::GetSize() const
+	{
+		return m_entityToSlot.size();
+	}
+
+	void SpatialHash::Insert(entt::entity entity, const SDL_FRect& bounds, int layer)
+	{
+		if (!IsFinite(bounds))
+		{
+			fmt::print(fg(fmt::color::red), "spatial hash: removing entity {} with non-finite bounds\n", static_cast<std::uint32_t>(entity));
+
+			// Mieux vaut ne plus trouver l'entité que la trouver à son ancienne position
+			Remove(entity);
+			return;
+		}
+
+		CellRange cells = ComputeCellRange(bounds);
+
+		auto it = m_entityToSlot.find(entity);
+		if (it != m_entityToSlot.end())
+		{
+			Item& item = m_items[it->second];
+			item.bounds = bounds;
+			item.layer = layer;
+
+			// Cas le plus fréquent : l'entité a bougé sans changer de cellule, il n'y a rien à réindexer
+			if (item.cells == cells)
+				return;
+
+			UnlinkItem(it->second);
+			item.cells = cells;
+			LinkItem(it->second);
+			return;
+		}
+
+		std::uint32_t slot;
+		if (!m_freeSlots.empty())
+		{
+			slot = m_freeSlots.back();
+			m_freeSlots.pop_back();
+		}
+		else
+		{
+			slot = static_cast<std::uint32_t>(m_items.size());
+			m_items.emplace_back();
+		}
+
+		Item& item = m_items[slot];
+		item.bounds = bounds;
+		item.cells = cells;
+		item.entity = entity;
+		item.layer = layer;
+		item.queryStamp = 0;
+
+		m_entityToSlot.emplace(entity, slot);
+		LinkItem(slot);
+	}
+
+	void SpatialHash::QueryPoint(const Vector2f& point, std::vector<entt::entity>& results) const
+	{
+		ForEachCandidate(SDL_FRect{ point.x, point.y, 0.f, 0.f }, [&](const Item& item)
+		{
+			const SDL_FRect& bounds = item.bounds;
+			if (point.x >= bounds.x && point.y >= bounds.y && point.x < bounds.x + bounds.w && point.y < bounds.y + bounds.h)
+				results.push_back(item.entity);
+		});
+	}
+
+	void SpatialHash::QueryRadius(const Vector2f& center, float radius, std::vector<entt::entity>& results) const
+	{
+		float sqRadius = radius * radius;
+		ForEachCandidate(SDL_FRect{ center.x - radius, center.y - radius, radius * 2.f, radius * 2.f }, [&](const Item& item)
+		{
+			// Distance entre le centre et le point de la boîte le plus proche
+			const SDL_FRect& bounds = item.bounds;
+			float dx = center.x - std::clamp(center.x, bounds.x, bounds.x + bounds.w);
+			float dy = center.y - std::clamp(center.y, bounds.y, bounds.y + bounds.h);
+			if (dx * dx + dy * dy <= sqRadius)
+				results.push_back(item.entity);
+		});
+	}
+
+	void SpatialHash::QueryRect(const SDL_FRect& rect, std::vector<entt::entity>& results) const
+	{
+		ForEachCandidate(rect, [&](const Item& item)
+		{
+			const SDL_FRect& bounds = item.bounds;
+			if (bounds.x <= rect.x + rect.w && rect.x <= bounds.x + bounds.w &&
+			    bounds.y <= rect.y + rect.h && rect.y <= bounds.y + bounds.h)
+			{
+				results.push_back(item.entity);
+			}
+		});
+	}
+
+	void SpatialHash::Remove(entt::entity entity)
+	{
+		auto it = m_entityToSlot.find(entity);
+		if (it == m_entityToSlot.end())
+			return;
+
+		std::uint32_t slot = it->second;
+		UnlinkItem(slot);
+
+		m_items[slot].entity = entt::null;
+		m_freeSlots.push_back(slot);
+		m_entityToSlot.erase(it);
+	}
+
+	SDL_FRect SpatialHash::ComputeWorldBounds(const Affine2f& matrix, const SDL_FRect& localBounds)
+	{
+		Vector2f corners[4] = {
+			matrix * Vector2f(localBounds.x, localBounds.y),
+			matrix * Vector2f(localBounds.x + localBounds.w, localBounds.y),
+			matrix * Vector2f(localBounds.x, localBounds.y + localBounds.h),
+			matrix * Vector2f(localBounds.x + localBounds.w, localBounds.y + localBounds.h)
+		};
+
+		Vector2f mins = corners[0];
+		Vector2f maxs = corners[0];
+		for (const Vector2f& corner : corners)
+		{
+			mins.x = std::min(mins.x, corner.x);
+			mins.y = std::min(mins.y, corner.y);
+			maxs.x = std::max(maxs.x, corner.x);
+			maxs.y = std::max(maxs.y, corner.y);
+		}
+
+		return SDL_FRect{ mins.x, mins.y, maxs.x - mins.x, maxs.y - mins.y };
+	}
+
+	SpatialHash::CellRange SpatialHash::ComputeCellRange(const SDL_FRect& bounds) const
+	{
+		CellRange range;
+		range.minX = ToCellCoord(bounds.x * m_invCellSize);
+		range.minY = ToCellCoord(bounds.y * m_invCellSize);
+		range.maxX = ToCellCoord((bounds.x + bounds.w) * m_invCellSize);
+		range.maxY = ToCellCoord((bounds.y + bounds.h) * m_invCellSize);
+
+		return range;
+	}
+
+	template<typename F>
+	void SpatialHash::ForEachCandidate(const SDL_FRect& area, F&& callback) const
+	{
+		// Une entité couvrant plusieurs cellules ne doit être testée qu'une fois par requête
+		std::uint32_t stamp = ++m_queryStamp;
+		if (stamp == 0)
+		{
+			for (const Item& item : m_items)
+				item.queryStamp = 0;
+
+			stamp = ++m_queryStamp;
+		}
+
+		auto Visit = [&](std::uint32_t slot)
+		{
+			const Item& item = m_items[slot];
+			if (item.queryStamp == stamp)
+				return;
+
+			item.queryStamp = stamp;
+			callback(item);
+		};
+
+		CellRange range = ComputeCellRange(area);
+		if (GetCellCount(range) > static_cast<long long>(m_cells.size()))
+		{
+			// Zone démesurée (ou infinie) : parcourir les cellules occupées coûte moins cher que la zone elle-même
+			for (auto&& [key, slots] : m_cells)
+			{
+				int x = static_cast<std::int32_t>(key >> 32);
+				int y = static_cast<std::int32_t>(key & 0xFFFFFFFF);
+				if (x < range.minX || x > range.maxX || y < range.minY || y > range.maxY)
+					continue;
+
+				for (std::uint32_t slot : slots)
+					Visit(slot);
+			}
+		}
+		else
+		{
+			for (int y = range.minY; y <= range.maxY; ++y)
+			{
+				for (int x = range.minX; x <= range.maxX; ++x)
+				{
+					auto it = m_cells.find(GetCellKey(x, y));
+					if (it == m_cells.end())
+						continue;
+
+					for (std::uint32_t slot : it->second)
+						Visit(slot);
+				}
+			}
+		}
+
+		for (std::uint32_t slot : m_largeItems)
+			Visit(slot);
+	}
+
+	void SpatialHash::LinkItem(std::uint32_t slot)
+	{
+		Item& item = m_items[slot];
+
+		item.isLarge = (GetCellCount(item.cells) > MaxCellsPerItem);
+		if (item.isLarge)
+		{
+			m_largeItems.push_back(slot);
+			return;
+		}
+
+		for (int y = item.cells.minY; y <= item.cells.maxY; ++y)
+		{
+			for (int x = item.cells.minX; x <= item.cells.maxX; ++x)
+				m_cells[GetCellKey(x, y)].push_back(slot);
+		}
+	}
+
+	void SpatialHash::UnlinkItem(std::uint32_t slot)
+	{
+		// L'ordre au sein d'une cellule n'a pas d'importance, on peut donc retirer par échange avec le dernier élément
+		auto EraseSlot = [slot](std::vector<std::uint32_t>& slots)
+		{
+			auto it = std::find(slots.begin(), slots.end(), slot);
+			assert(it != slots.end());
+
+			*it = slots.back();
+			slots.pop_back();
+		};
+
+		const Item& item = m_items[slot];
+		if (item.isLarge)
+		{
+			EraseSlot(m_largeItems);
+			return;
+		}
+
+		// Les cellules vidées sont supprimées : une entité qui traverse le monde laisserait sinon derrière elle
+		// une cellule par case visitée, et la table grossirait sans limite
+		for (int y = item.cells.minY; y <= item.cells.maxY; ++y)
+		{
+			for (int x = item.cells.minX; x <= item.cells.maxX; ++x)
+			{
+				auto it = m_cells.find(GetCellKey(x, y));
+				assert(it != m_cells.end());
+
+				EraseSlot(it->second);
+				if (it->second.empty())
+					m_cells.erase(it);
+			}
+		}
+	}
+
+	long long SpatialHash::GetCellCount(const CellRange& range)
+	{
+		long long width = static_cast<long long>(range.maxX) - range.minX + 1;
+		long long height = static_cast<long long>(range.maxY) - range.minY + 1;
+		if (width <= 0 || height <= 0)
+			return 0;
+
+		// Au plus 2^32 cellules par axe : le produit tient dans un long long
+		return width * height;
+	}
+
+	std::uint64_t SpatialHash::GetCellKey(int x, int y)
+	{
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+	}
+}
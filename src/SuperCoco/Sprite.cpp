@@ -2,7 +2,8 @@
 #include <SuperCoco/Texture.hpp>
 #include <SuperCoco/Renderer.hpp>
 #include <SuperCoco/ResourceManager.hpp>
-#include <SuperCoco/Matrix.hpp>
+#include <SuperCoco/Affine2.hpp>
+#include <SuperCoco/VertexTransform.hpp>
 #include <SuperCoco/JsonSerializer.hpp>
 #include <nlohmann/json.hpp>
 #include <imgui.h>
@@ -28,37 +29,34 @@ namespace Sce
 			m_texturePath = m_texture->GetFilepath();
 	}
 
-	void Sprite::Render(Renderer& renderer, const Matrixf& transformMatrix) const
+	void Sprite::Render(Renderer& renderer, const Affine2f& transformMatrix) const
 	{
 		Vector2f originShift{ m_width * m_origin.x, m_height * m_origin.y };
-		Vector2f screenShift{ 0, 0 };
-
-		Vector2f p1 = (transformMatrix * Matrixf::MakeFromPosition({ -originShift.x, -originShift.y })).GetVector2() + screenShift;
-		Vector2f p2 = (transformMatrix * Matrixf::MakeFromPosition({ m_width - originShift.x, -originShift.y })).GetVector2() + screenShift;
-		Vector2f p3 = (transformMatrix * Matrixf::MakeFromPosition({ -originShift.x, m_height - originShift.y })).GetVector2() + screenShift;
-		Vector2f p4 = (transformMatrix * Matrixf::MakeFromPosition({ m_width - originShift.x, m_height - originShift.y})).GetVector2() + screenShift;
+		Vector2f corners[4] = {
+			Vector2f(-originShift.x, -originShift.y),
+			Vector2f(m_width - originShift.x, -originShift.y),
+			Vector2f(-originShift.x, m_height - originShift.y),
+			Vector2f(m_width - originShift.x, m_height - originShift.y)
+		};
 
-		SDL_Rect textureRect = m_texture->GetRect();
-		float invWidth = 1.f / textureRect.w;
-		float invHeight = 1.f / textureRect.h;
+		// m_rect est exprimé dans la texture, qui peut n'être qu'une région d'une page d'atlas
+		SDL_FRect texCoords = m_texture->GetTexCoords(m_rect);
 		
 		SDL_Vertex vertices[4];
 
-		vertices[0].position = p1;
 		vertices[0].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[0].tex_coord = SDL_FPoint{ static_cast<float>(m_rect.x) * invWidth, static_cast<float>(m_rect.y) * invHeight };
+		vertices[0].tex_coord = SDL_FPoint{ texCoords.x, texCoords.y };
 
-		vertices[1].position = p2;
 		vertices[1].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[1].tex_coord = SDL_FPoint{ static_cast<float>(m_rect.x + m_rect.w) * invWidth, static_cast<float>(m_rect.y) * invHeight};
+		vertices[1].tex_coord = SDL_FPoint{ texCoords.x + texCoords.w, texCoords.y };
 
-		vertices[2].position = p3;
 		vertices[2].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[2].tex_coord = SDL_FPoint{ static_cast<float>(m_rect.x) * invWidth, static_cast<float>(m_rect.y + m_rect.h) * invHeight };
+		vertices[2].tex_coord = SDL_FPoint{ texCoords.x, texCoords.y + texCoords.h };
 
-		vertices[3].position = p4;
 		vertices[3].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[3].tex_coord = SDL_FPoint{ static_cast<float>(m_rect.x + m_rect.w) * invWidth, static_cast<float>(m_rect.y + m_rect.h) * invHeight };
+		vertices[3].tex_coord = SDL_FPoint{ texCoords.x + texCoords.w, texCoords.y + texCoords.h };
+
+		TransformPoints(transformMatrix, corners, vertices, 4);
 
 		int indices[6]{0, 1, 2, 1, 3, 2};
 
@@ -82,6 +80,11 @@ namespace Sce
 		return m_layer;
 	}
 
+	const Texture* Sprite::GetTexture() const
+	{
+		return m_texture.get();
+	}
+
 	void Sprite::PopulateInspector(WorldEditor& worldEditor)
 	{
 		if (!ImGui::TreeNode("Sprite"))
@@ -68,6 +68,19 @@ namespace Sce
 		return spritesheet;
 	}
 
+	Spritesheet Spritesheet::LoadFromMemory(const void* data, std::size_t size)
+	{
+		const char* begin = static_cast<const char*>(data);
+		nlohmann::json doc = nlohmann::json::parse(begin, begin + size);
+
+		Spritesheet spritesheet;
+
+		for (Animation animation : doc.at("Animations"))
+			spritesheet.AddAnimation(std::move(animation));
+
+		return spritesheet;
+	}
+
 	const Spritesheet::Animation& Spritesheet::GetAnimation(std::size_t animIndex) const
 	{
 		return m_animations[animIndex];
@@ -82,6 +95,15 @@ namespace Sce
 		return it->second; //< on retourne l'index de l'animation
 	}
 
+	std::size_t Spritesheet::GetMemorySize() const
+	{
+		std::size_t memorySize = m_animations.capacity() * sizeof(Animation);
+		for (const Animation& animation : m_animations)
+			memorySize += animation.name.capacity();
+
+		return memorySize;
+	}
+
 	std::size_t Spritesheet::GetAnimationCount() const
 	{
 		return m_animations.size();
@@ -24,6 +24,30 @@ namespace Sce
 			SDL_FreeSurface(m_surface);
 	}
 
+	void Surface::Blit(const Surface& source, int x, int y)
+	{
+		assert(m_surface);
+		assert(source.m_surface);
+
+		// Copie brute des pixels (sans mélange alpha) pour conserver la transparence de la source
+		SDL_SetSurfaceBlendMode(source.m_surface, SDL_BLENDMODE_NONE);
+
+		SDL_Rect destRect{ x, y, source.m_surface->w, source.m_surface->h };
+		if (SDL_BlitSurface(source.m_surface, nullptr, m_surface, &destRect) != 0)
+			throw std::runtime_error(SDL_GetError());
+	}
+
+	Surface Surface::ConvertToRGBA32() const
+	{
+		assert(m_surface);
+
+		SDL_Surface* surface = SDL_ConvertSurfaceFormat(m_surface, SDL_PIXELFORMAT_RGBA32, 0);
+		if (!surface)
+			throw std::runtime_error(SDL_GetError());
+
+		return Surface(surface);
+	}
+
 	void Surface::FillRect(const SDL_Rect& rect, std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
 	{
 		assert(m_surface);
@@ -37,6 +61,12 @@ namespace Sce
 		return *this;
 	}
 
+	int Surface::GetHeight() const
+	{
+		assert(m_surface);
+		return m_surface->h;
+	}
+
 	std::uint8_t* Surface::GetPixels()
 	{
 		assert(m_surface);
@@ -49,6 +79,24 @@ namespace Sce
 		return static_cast<const std::uint8_t*>(m_surface->pixels);
 	}
 
+	int Surface::GetPitch() const
+	{
+		assert(m_surface);
+		return m_surface->pitch;
+	}
+
+	int Surface::GetWidth() const
+	{
+		assert(m_surface);
+		return m_surface->w;
+	}
+
+	bool Surface::SaveToPNG(const std::string& path) const
+	{
+		assert(m_surface);
+		return IMG_SavePNG(m_surface, path.c_str()) == 0;
+	}
+
 	Surface Surface::Create(int width, int height)
 	{
 		SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
@@ -67,6 +115,29 @@ namespace Sce
 		return Surface(surface);
 	}
 
+	Surface Surface::LoadFromMemory(const void* data, std::size_t size)
+	{
+		// SDL_image décode directement depuis le buffer (fichier projeté en mémoire par exemple), sans copie intermédiaire
+		SDL_RWops* rw = SDL_RWFromConstMem(data, static_cast<int>(size));
+		if (!rw)
+			throw std::runtime_error(SDL_GetError());
+
+		SDL_Surface* surface = IMG_Load_RW(rw, 1);
+		if (!surface)
+			throw std::runtime_error(SDL_GetError());
+
+		return Surface(surface);
+	}
+
+	Surface Surface::CreateTTFGlyphSurface(TTF_Font* font, std::uint32_t codepoint, const SDL_Color& color)
+	{
+		SDL_Surface* surface = TTF_RenderGlyph32_Blended(font, codepoint, color);
+		if (!surface)
+			throw std::runtime_error(SDL_GetError());
+
+		return Surface(surface);
+	}
+
 	Surface Surface::CreateTTFSurface(TTF_Font* font, const std::string& text, const SDL_Color& color)
 	{
 		SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), color);
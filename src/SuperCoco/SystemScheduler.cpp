@@ -0,0 +1,183 @@
+#include <SuperCoco/SystemScheduler.hpp>
+#include <SuperCoco/ThreadPool.hpp>
+#include <algorithm>
+
+namespace Sce
+{
+	SystemScheduler::SystemScheduler(entt::registry& registry, ThreadPool& threadPool) :
+	m_registry(registry),
+	m_threadPool(threadPool),
+	m_completedCount(0),
+	m_deltaTime(0.f),
+	m_isGraphDirty(true)
+	{
+	}
+
+	SystemScheduler::~SystemScheduler() = default;
+
+	SystemScheduler::System& SystemScheduler::AddSystem(std::string name, std::function<void(float deltaTime)> update)
+	{
+		m_isGraphDirty = true;
+		return *m_systems.emplace_back(std::make_unique<System>(std::move(name), std::move(update)));
+	}
+
+	void SystemScheduler::Run(float deltaTime)
+	{
+		if (m_isGraphDirty)
+			BuildGraph();
+
+		std::unique_lock lock(m_mutex);
+
+		m_completedCount = 0;
+		m_deltaTime = deltaTime;
+		m_error = nullptr;
+		for (auto& systemPtr : m_systems)
+			systemPtr->m_remainingDependencies = systemPtr->m_dependencyCount;
+
+		for (std::size_t i = 0; i < m_systems.size(); ++i)
+		{
+			if (m_systems[i]->m_dependencyCount == 0)
+				Schedule(i);
+		}
+
+		while (m_completedCount < m_systems.size())
+		{
+			if (!m_mainThreadQueue.empty())
+			{
+				std::size_t systemIndex = m_mainThreadQueue.front();
+				m_mainThreadQueue.erase(m_mainThreadQueue.begin());
+
+				lock.unlock();
+				Execute(systemIndex);
+				lock.lock();
+				continue;
+			}
+
+			// Plutôt que d'attendre, le thread principal exécute lui-même les tâches en file
+			lock.unlock();
+			bool hasRunTask = m_threadPool.RunPendingTask();
+			lock.lock();
+
+			if (!hasRunTask)
+				m_systemCompleted.wait(lock, [this] { return m_completedCount == m_systems.size() || !m_mainThreadQueue.empty(); });
+		}
+
+		if (m_error)
+			std::rethrow_exception(m_error);
+	}
+
+	void SystemScheduler::BuildGraph()
+	{
+		// Le graphe ne dépend que des déclarations : il n'est reconstruit que lorsqu'un système est ajouté,
+		// seuls les compteurs de dépendances sont réinitialisés à chaque frame
+		for (auto& systemPtr : m_systems)
+		{
+			systemPtr->m_dependents.clear();
+			systemPtr->m_dependencyCount = 0;
+
+			for (const auto& assureStorage : systemPtr->m_storageAssurers)
+				assureStorage(m_registry);
+		}
+
+		for (std::size_t i = 0; i < m_systems.size(); ++i)
+		{
+			for (std::size_t j = i + 1; j < m_systems.size(); ++j)
+			{
+				if (!m_systems[i]->ConflictsWith(*m_systems[j]))
+					continue;
+
+				m_systems[i]->m_dependents.push_back(j);
+				m_systems[j]->m_dependencyCount++;
+			}
+		}
+
+		m_isGraphDirty = false;
+	}
+
+	void SystemScheduler::Execute(std::size_t systemIndex)
+	{
+		System& system = *m_systems[systemIndex];
+
+		std::exception_ptr error;
+		try
+		{
+			system.m_update(m_deltaTime);
+		}
+		catch (...)
+		{
+			error = std::current_exception();
+		}
+
+		std::lock_guard lock(m_mutex);
+		if (!m_error)
+			m_error = std::move(error);
+
+		error = nullptr;
+
+		for (std::size_t dependentIndex : system.m_dependents)
+		{
+			if (--m_systems[dependentIndex]->m_remainingDependencies == 0)
+				Schedule(dependentIndex);
+		}
+
+		m_completedCount++;
+
+		// Notifié sous le verrou : Run peut revenir (et le scheduler être détruit) dès que celui-ci est relâché
+		m_systemCompleted.notify_all();
+	}
+
+	void SystemScheduler::Schedule(std::size_t systemIndex)
+	{
+		// Appelée avec m_mutex verrouillé
+		const System& system = *m_systems[systemIndex];
+		if (system.m_isExclusive || system.m_isMainThreadOnly)
+			m_mainThreadQueue.push_back(systemIndex);
+		else
+			m_threadPool.Submit([this, systemIndex] { Execute(systemIndex); });
+	}
+
+	SystemScheduler::System::System(std::string name, std::function<void(float deltaTime)> update) :
+	m_update(std::move(update)),
+	m_name(std::move(name)),
+	m_dependencyCount(0),
+	m_remainingDependencies(0),
+	m_isExclusive(false),
+	m_isMainThreadOnly(false)
+	{
+	}
+
+	SystemScheduler::System& SystemScheduler::System::Exclusive()
+	{
+		m_isExclusive = true;
+		return *this;
+	}
+
+	const std::string& SystemScheduler::System::GetName() const
+	{
+		return m_name;
+	}
+
+	SystemScheduler::System& SystemScheduler::System::RunOnMainThread()
+	{
+		m_isMainThreadOnly = true;
+		return *this;
+	}
+
+	bool SystemScheduler::System::ConflictsWith(const System& other) const
+	{
+		if (m_isExclusive || other.m_isExclusive)
+			return true;
+
+		auto Intersects = [](const std::vector<entt::id_type>& lhs, const std::vector<entt::id_type>& rhs)
+		{
+			return std::any_of(lhs.begin(), lhs.end(), [&](entt::id_type componentId)
+			{
+				return std::find(rhs.begin(), rhs.end(), componentId) != rhs.end();
+			});
+		};
+
+		return Intersects(m_writeComponents, other.m_writeComponents) ||
+		       Intersects(m_writeComponents, other.m_readComponents) ||
+		       Intersects(m_readComponents, other.m_writeComponents);
+	}
+}
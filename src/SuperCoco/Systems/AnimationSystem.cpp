@@ -1,22 +1,31 @@
 #include <SuperCoco/Systems/AnimationSystem.hpp>
 #include <SuperCoco/Components/GraphicsComponent.hpp>
+#include <SuperCoco/Components/PoolComponents.hpp>
 #include <SuperCoco/SpriteSheet.hpp>
 #include <SuperCoco/Components/SpritesheetComponent.hpp>
 #include <SuperCoco/Sprite.hpp>
+#include <SuperCoco/ParallelForEach.hpp>
 
 namespace Sce
 {
-	AnimationSystem::AnimationSystem(entt::registry* registry) :
-	m_registry(registry)
+	AnimationSystem::AnimationSystem(entt::registry* registry, ThreadPool* threadPool) :
+	m_registry(registry),
+	m_threadPool(threadPool)
 	{
 	}
 
 	void AnimationSystem::Update(float deltaTime)
 	{
-		auto view = m_registry->view<SpritesheetComponent>();
-		for (auto&& [entity, spritesheet] : view.each())
+		// Chaque composant anime son propre sprite, les spritesheets partagées ne sont que lues
+		auto UpdateAnimation = [deltaTime](entt::entity /*entity*/, SpritesheetComponent& spritesheet)
 		{
 			spritesheet.Update(deltaTime);
-		}
+		};
+
+		auto view = m_registry->view<SpritesheetComponent>(entt::exclude<InactiveComponent>);
+		if (m_threadPool)
+			ParallelForEach(*m_threadPool, view, UpdateAnimation);
+		else
+			view.each(UpdateAnimation);
 	}
 }
@@ -0,0 +1,37 @@
+#include <SuperCoco/Systems/AssetLoadingSystem.hpp>
+#include <SuperCoco/Components/GraphicsComponent.hpp>
+#include <SuperCoco/Components/PendingModelComponent.hpp>
+#include <SuperCoco/Components/PoolComponents.hpp>
+#include <SuperCoco/Model.hpp>
+
+namespace Sce
+{
+	AssetLoadingSystem::AssetLoadingSystem(entt::registry* registry) :
+	m_registry(registry)
+	{
+	}
+
+	void AssetLoadingSystem::Update()
+	{
+		m_loadedEntities.clear();
+		for (auto&& [entity, pendingModel] : m_registry->view<PendingModelComponent>().each())
+		{
+			if (pendingModel.model.IsReady())
+				m_loadedEntities.push_back(entity);
+		}
+
+		for (entt::entity entity : m_loadedEntities)
+		{
+			// En cas d'échec, Get() renvoie le modèle "manquant" déjà affiché
+			std::shared_ptr<Model> model = m_registry->get<PendingModelComponent>(entity).model.Get();
+
+			// Passer par patch prévient la liste de rendu et l'index spatial que le renderable (et donc ses bornes) a changé
+			if (m_registry->all_of<GraphicsComponent>(entity))
+				m_registry->patch<GraphicsComponent>(entity, [&](GraphicsComponent& graphics) { graphics.m_renderable = std::move(model); });
+			else if (InactiveComponent* inactive = m_registry->try_get<InactiveComponent>(entity); inactive && inactive->graphics)
+				inactive->graphics->m_renderable = std::move(model);
+		}
+
+		m_registry->remove<PendingModelComponent>(m_loadedEntities.begin(), m_loadedEntities.end());
+	}
+}
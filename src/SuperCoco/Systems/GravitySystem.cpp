@@ -1,17 +1,27 @@
 #include <SuperCoco/Systems/GravitySystem.hpp>
+#include <SuperCoco/Components/PoolComponents.hpp>
 #include <SuperCoco/Components/VelocityComponent.hpp>
+#include <SuperCoco/ParallelForEach.hpp>
 
 namespace Sce
 {
-	GravitySystem::GravitySystem(entt::registry* registry) :
-	m_registry(registry)
+	GravitySystem::GravitySystem(entt::registry* registry, ThreadPool* threadPool) :
+	m_registry(registry),
+	m_threadPool(threadPool)
 	{
 	}
 
 	void GravitySystem::ApplyGravity(float deltaTime)
 	{
-		auto view = m_registry->view<VelocityComponent>();
-		for (auto&& [entity, velocity] : view.each())
+		auto ApplyToVelocity = [deltaTime](entt::entity /*entity*/, VelocityComponent& velocity)
+		{
 			velocity.linearVel.y += 1000.f * deltaTime;
+		};
+
+		auto view = m_registry->view<VelocityComponent>(entt::exclude<InactiveComponent>);
+		if (m_threadPool)
+			ParallelForEach(*m_threadPool, view, ApplyToVelocity);
+		else
+			view.each(ApplyToVelocity);
 	}
 }
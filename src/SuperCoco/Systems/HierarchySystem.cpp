@@ -0,0 +1,202 @@
+#include <SuperCoco/Systems/HierarchySystem.hpp>
+#include <SuperCoco/Components/HierarchyComponent.hpp>
+#include <SuperCoco/Components/PoolComponents.hpp>
+#include <SuperCoco/ThreadPool.hpp>
+#include <SuperCoco/Transform.hpp>
+
+namespace Sce
+{
+	HierarchySystem::HierarchySystem(entt::registry* registry, ThreadPool* threadPool) :
+	m_registry(registry),
+	m_threadPool(threadPool),
+	m_isSortRequired(true)
+	{
+		m_registry->on_construct<Transform>().connect<&HierarchySystem::OnTransformConstruct>(this);
+		m_registry->on_destroy<Transform>().connect<&HierarchySystem::OnTransformDestroy>(this);
+		m_registry->on_destroy<HierarchyComponent>().connect<&HierarchySystem::OnHierarchyDestroy>(this);
+		m_registry->on_update<HierarchyComponent>().connect<&HierarchySystem::OnHierarchyUpdate>(this);
+
+		// Les Transform créés avant le système n'ont pas encore de HierarchyComponent (ajouté hors du parcours de la vue)
+		auto unlinkedView = m_registry->view<Transform>(entt::exclude<HierarchyComponent>);
+		std::vector<entt::entity> unlinkedEntities(unlinkedView.begin(), unlinkedView.end());
+		for (entt::entity entity : unlinkedEntities)
+			OnTransformConstruct(*m_registry, entity);
+	}
+
+	HierarchySystem::~HierarchySystem()
+	{
+		m_registry->on_construct<Transform>().disconnect(this);
+		m_registry->on_destroy<Transform>().disconnect(this);
+		m_registry->on_destroy<HierarchyComponent>().disconnect(this);
+		m_registry->on_update<HierarchyComponent>().disconnect(this);
+	}
+
+	std::span<const entt::entity> HierarchySystem::GetMovedEntities() const
+	{
+		return m_movedEntities;
+	}
+
+	void HierarchySystem::Update()
+	{
+		if (m_isSortRequired)
+		{
+			// Tri par insertion : la hiérarchie change peu d'une frame à l'autre, les pools restent presque triés
+			m_registry->sort<HierarchyComponent>([](const HierarchyComponent& lhs, const HierarchyComponent& rhs)
+			{
+				return lhs.depth < rhs.depth;
+			}, entt::insertion_sort{});
+
+			// Le pool des Transform suit le même ordre, le parcours ci-dessous le lit donc linéairement
+			m_registry->sort<Transform, HierarchyComponent>();
+			m_isSortRequired = false;
+		}
+
+		// Les nouvelles racines (profondeur 0) sont placées en tête de parcours par EnTT et ne nécessitent pas de tri
+		m_depthOrder.clear();
+		m_levelOffsets.clear();
+		auto& inactiveEntities = m_registry->storage<InactiveComponent>();
+		for (auto&& [entity, hierarchy] : m_registry->storage<HierarchyComponent>().each())
+		{
+			// Une entité rangée dans un pool n'est ni affichée ni simulée, sa matrice sera recalculée à sa réactivation.
+			// Sauf si elle a des enfants : ils la liraient (et la recalculeraient) en parallèle pendant le traitement de leur niveau
+			if (hierarchy.firstChild == entt::null && inactiveEntities.contains(entity))
+				continue;
+
+			while (m_levelOffsets.size() <= hierarchy.depth)
+				m_levelOffsets.push_back(m_depthOrder.size());
+
+			m_depthOrder.push_back(entity);
+		}
+		m_levelOffsets.push_back(m_depthOrder.size());
+
+		m_movedFlags.assign(m_depthOrder.size(), 0);
+
+		// Un niveau ne dépend que du précédent : ses entités peuvent être traitées dans n'importe quel ordre
+		std::span<const entt::entity> depthOrder(m_depthOrder);
+		std::span<std::uint8_t> movedFlags(m_movedFlags);
+		for (std::size_t level = 0; level + 1 < m_levelOffsets.size(); ++level)
+		{
+			std::size_t levelSize = m_levelOffsets[level + 1] - m_levelOffsets[level];
+			UpdateWorldMatrices(depthOrder.subspan(m_levelOffsets[level], levelSize), movedFlags.subspan(m_levelOffsets[level], levelSize));
+		}
+
+		m_movedEntities.clear();
+		for (std::size_t i = 0; i < m_depthOrder.size(); ++i)
+		{
+			if (m_movedFlags[i])
+				m_movedEntities.push_back(m_depthOrder[i]);
+		}
+	}
+
+	bool HierarchySystem::SetParent(entt::registry& registry, entt::entity entity, entt::entity parent)
+	{
+		HierarchyComponent& node = registry.get<HierarchyComponent>(entity);
+		if (node.parent == parent)
+			return true;
+
+		for (entt::entity ancestor = parent; ancestor != entt::null; ancestor = registry.get<HierarchyComponent>(ancestor).parent)
+		{
+			if (ancestor == entity)
+				return false;
+		}
+
+		// Détachement de l'ancien parent, en temps constant grâce aux liens vers les frères
+		if (node.parent != entt::null)
+		{
+			if (node.previousSibling != entt::null)
+				registry.get<HierarchyComponent>(node.previousSibling).nextSibling = node.nextSibling;
+			else
+				registry.get<HierarchyComponent>(node.parent).firstChild = node.nextSibling;
+
+			if (node.nextSibling != entt::null)
+				registry.get<HierarchyComponent>(node.nextSibling).previousSibling = node.previousSibling;
+		}
+
+		node.parent = parent;
+		node.previousSibling = entt::null;
+		node.nextSibling = entt::null;
+
+		std::uint32_t depth = 0;
+		if (parent != entt::null)
+		{
+			HierarchyComponent& parentNode = registry.get<HierarchyComponent>(parent);
+			if (parentNode.firstChild != entt::null)
+				registry.get<HierarchyComponent>(parentNode.firstChild).previousSibling = entity;
+
+			node.nextSibling = parentNode.firstChild;
+			parentNode.firstChild = entity;
+			depth = parentNode.depth + 1;
+		}
+
+		UpdateDepth(registry, entity, depth);
+
+		if (Transform* transform = registry.try_get<Transform>(entity))
+			transform->InvalidateWorld();
+
+		return true;
+	}
+
+	void HierarchySystem::OnHierarchyDestroy(entt::registry& registry, entt::entity entity)
+	{
+		// Les enfants deviennent des racines, puis l'entité est retirée de la liste des enfants de son parent
+		HierarchyComponent& node = registry.get<HierarchyComponent>(entity);
+		while (node.firstChild != entt::null)
+			SetParent(registry, node.firstChild, entt::null);
+
+		SetParent(registry, entity, entt::null);
+		m_isSortRequired = true;
+	}
+
+	void HierarchySystem::OnHierarchyUpdate(entt::registry& /*registry*/, entt::entity /*entity*/)
+	{
+		m_isSortRequired = true;
+	}
+
+	void HierarchySystem::OnTransformConstruct(entt::registry& registry, entt::entity entity)
+	{
+		registry.emplace_or_replace<HierarchyComponent>(entity);
+		registry.get<Transform>(entity).Link(registry, entity);
+	}
+
+	void HierarchySystem::OnTransformDestroy(entt::registry& registry, entt::entity entity)
+	{
+		// Le détachement est fait par OnHierarchyDestroy (que le HierarchyComponent soit retiré ici ou avant par EnTT)
+		registry.remove<HierarchyComponent>(entity);
+		registry.get<Transform>(entity).Unlink();
+	}
+
+	void HierarchySystem::UpdateWorldMatrices(std::span<const entt::entity> entities, std::span<std::uint8_t> movedFlags)
+	{
+		// Le parent ayant été traité au niveau précédent, sa matrice monde est déjà en cache et n'est que lue
+		auto& transforms = m_registry->storage<Transform>();
+		auto UpdateRange = [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				Transform& transform = transforms.get(entities[i]);
+				transform.LocalToWorldMatrix();
+
+				movedFlags[i] = transform.m_hasWorldChanged;
+				transform.m_hasWorldChanged = false;
+			}
+		};
+
+		if (m_threadPool)
+			m_threadPool->ParallelFor(entities.size(), UpdateRange);
+		else
+			UpdateRange(0, entities.size());
+	}
+
+	void HierarchySystem::UpdateDepth(entt::registry& registry, entt::entity entity, std::uint32_t depth)
+	{
+		HierarchyComponent& node = registry.get<HierarchyComponent>(entity);
+		if (node.depth == depth)
+			return; //< la profondeur des descendants est relative : elle est déjà correcte
+
+		node.depth = depth;
+		registry.patch<HierarchyComponent>(entity); //< signale qu'un nouveau tri est nécessaire
+
+		for (entt::entity child = node.firstChild; child != entt::null; child = registry.get<HierarchyComponent>(child).nextSibling)
+			UpdateDepth(registry, child, depth + 1);
+	}
+}
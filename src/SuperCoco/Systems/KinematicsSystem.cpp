@@ -0,0 +1,125 @@
+#include <SuperCoco/Systems/KinematicsSystem.hpp>
+#include <SuperCoco/Components/GraphicsComponent.hpp>
+#include <SuperCoco/Components/KinematicsComponents.hpp>
+#include <SuperCoco/Components/PoolComponents.hpp>
+#include <SuperCoco/KinematicsIntegration.hpp>
+#include <SuperCoco/ThreadPool.hpp>
+#include <SuperCoco/Transform.hpp>
+#include <algorithm>
+
+namespace Sce
+{
+	namespace
+	{
+		// Les colonnes sont lues directement dans les pages des pools : un composant doit être exactement un float
+		// et tous les pools doivent partager la même taille de page pour qu'un même indice désigne la même entité
+		template<typename... Components>
+		constexpr bool IsColumnLayout = ((sizeof(Components) == sizeof(float) && entt::component_traits<Components>::page_size == entt::component_traits<KinematicPositionX>::page_size) && ...);
+
+		static_assert(IsColumnLayout<KinematicPositionX, KinematicPositionY, KinematicVelocityX, KinematicVelocityY, KinematicAccelerationX, KinematicAccelerationY>);
+
+		constexpr std::size_t PageSize = entt::component_traits<KinematicPositionX>::page_size;
+
+		// Les entités rangées dans un pool sortent du groupe (EnTT les déplace après sa plage) et ne sont donc plus intégrées
+		auto GetKinematicsGroup(entt::registry& registry)
+		{
+			return registry.group<KinematicPositionX, KinematicPositionY, KinematicVelocityX, KinematicVelocityY, KinematicAccelerationX, KinematicAccelerationY>(entt::get<>, entt::exclude<InactiveComponent>);
+		}
+
+		// Adresse du composant à l'indice index du pool, les éléments suivants de la même page lui sont contigus
+		template<typename Component>
+		float* GetColumn(entt::registry& registry, std::size_t index)
+		{
+			auto& storage = registry.storage<Component>();
+			return &storage.get(storage.data()[index]).value;
+		}
+	}
+
+	KinematicsSystem::KinematicsSystem(entt::registry* registry, ThreadPool* threadPool, float gravity, float groundHeight) :
+	m_registry(registry),
+	m_threadPool(threadPool),
+	m_gravity(gravity),
+	m_groundHeight(groundHeight)
+	{
+		// Le groupe doit exister avant l'ajout des composants pour que les pools soient tenus alignés dès le départ
+		GetKinematicsGroup(*m_registry);
+	}
+
+	void KinematicsSystem::Update(float deltaTime)
+	{
+		static const SimdLevel s_simdLevel = GetSupportedSimdLevel();
+		Update(s_simdLevel, deltaTime);
+	}
+
+	void KinematicsSystem::Update(SimdLevel level, float deltaTime)
+	{
+		Integrate(level, deltaTime);
+		SyncTransforms();
+	}
+
+	void KinematicsSystem::AddKinematics(entt::registry& registry, entt::entity entity, const Vector2f& position, const Vector2f& velocity, const Vector2f& acceleration)
+	{
+		registry.emplace<KinematicPositionX>(entity, position.x);
+		registry.emplace<KinematicPositionY>(entity, position.y);
+		registry.emplace<KinematicVelocityX>(entity, velocity.x);
+		registry.emplace<KinematicVelocityY>(entity, velocity.y);
+		registry.emplace<KinematicAccelerationX>(entity, acceleration.x);
+		registry.emplace<KinematicAccelerationY>(entity, acceleration.y);
+	}
+
+	void KinematicsSystem::RemoveKinematics(entt::registry& registry, entt::entity entity)
+	{
+		registry.remove<KinematicPositionX, KinematicPositionY, KinematicVelocityX, KinematicVelocityY, KinematicAccelerationX, KinematicAccelerationY>(entity);
+	}
+
+	void KinematicsSystem::Integrate(SimdLevel level, float deltaTime)
+	{
+		std::size_t count = GetKinematicsGroup(*m_registry).size();
+		if (count == 0)
+			return;
+
+		KinematicsSettings settings;
+		settings.deltaTime = deltaTime;
+		settings.gravity = m_gravity;
+		settings.groundHeight = m_groundHeight;
+
+		// Une page de pool est la plus grande plage contiguë garantie : c'est l'unité de travail du noyau
+		auto IntegratePages = [&](std::size_t firstPage, std::size_t lastPage)
+		{
+			for (std::size_t page = firstPage; page < lastPage; ++page)
+			{
+				std::size_t first = page * PageSize;
+
+				KinematicsColumns columns;
+				columns.positionX = GetColumn<KinematicPositionX>(*m_registry, first);
+				columns.positionY = GetColumn<KinematicPositionY>(*m_registry, first);
+				columns.velocityX = GetColumn<KinematicVelocityX>(*m_registry, first);
+				columns.velocityY = GetColumn<KinematicVelocityY>(*m_registry, first);
+				columns.accelerationX = GetColumn<KinematicAccelerationX>(*m_registry, first);
+				columns.accelerationY = GetColumn<KinematicAccelerationY>(*m_registry, first);
+
+				IntegrateKinematics(level, columns, std::min(PageSize, count - first), settings);
+			}
+		};
+
+		std::size_t pageCount = (count + PageSize - 1) / PageSize;
+		if (m_threadPool && pageCount > 1)
+			m_threadPool->ParallelFor(pageCount, IntegratePages, 1);
+		else
+			IntegratePages(0, pageCount);
+	}
+
+	void KinematicsSystem::SyncTransforms()
+	{
+		// Les entités non affichées gardent leur position dans les colonnes uniquement, ce qui évite d'invalider
+		// leurs matrices (et celles de leurs descendants) à chaque frame. Il en va de même pour une entité au repos (posée au sol) :
+		// on n'écrit que les positions qui ont changé, sans quoi la hiérarchie la signalerait comme déplacée à chaque frame
+		auto view = m_registry->view<KinematicPositionX, KinematicPositionY, GraphicsComponent, Transform>(entt::exclude<InactiveComponent>);
+		for (auto&& [entity, positionX, positionY, graphics, transform] : view.each())
+		{
+			const Vector2f& position = transform.GetPosition();
+			if (position.x != positionX.value || position.y != positionY.value)
+				transform.SetPosition(Vector2f(positionX.value, positionY.value));
+		}
+	}
+}
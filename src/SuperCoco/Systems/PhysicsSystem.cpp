@@ -1,4 +1,5 @@
 #include <SuperCoco/Systems/PhysicsSystem.hpp>
+#include <SuperCoco/Components/PoolComponents.hpp>
 #include <SuperCoco/Components/RigidBodyComponent.hpp>
 #include <SuperCoco/Transform.hpp>
 #include <entt/entt.hpp>
@@ -45,7 +46,7 @@ namespace Sce
 			m_accumulator -= m_timestep;
 		}
 
-		auto view = m_registry.view<Transform, RigidBodyComponent>();
+		auto view = m_registry.view<Transform, RigidBodyComponent>(entt::exclude<InactiveComponent>);
 		for (entt::entity entity : view)
 		{
 			Transform& entityTransform = view.get<Transform>(entity);
@@ -2,57 +2,260 @@
 #include <SuperCoco/Transform.hpp>
 #include <SuperCoco/Components/GraphicsComponent.hpp>
 #include <SuperCoco/Components/CameraComponent.hpp>
-#include <SuperCoco/Sprite.hpp>
-#include <SuperCoco/Matrix.hpp>
-#include <tuple>
+#include <SuperCoco/Renderer.hpp>
+#include <SuperCoco/Renderable.hpp>
+#include <SuperCoco/SpatialHash.hpp>
+#include <SuperCoco/Texture.hpp>
+#include <SuperCoco/Window.hpp>
+#include <SuperCoco/Affine2.hpp>
+#include <SDL2/SDL_rect.h>
 #include <algorithm>
+#include <utility>
 
 namespace Sce
 {
-	RenderSystem::RenderSystem(entt::registry* registry, Renderer* renderer) :
+	// Au-delà de cet écart entre le plus petit et le plus grand layer, le tri par paquets coûterait
+	// plus cher en mémoire qu'un tri par comparaison
+	constexpr int MaxBucketedLayerRange = 4096;
+
+	namespace
+	{
+		bool Overlaps(const SDL_FRect& lhs, const SDL_FRect& rhs)
+		{
+			return lhs.x <= rhs.x + rhs.w && rhs.x <= lhs.x + lhs.w &&
+			       lhs.y <= rhs.y + rhs.h && rhs.y <= lhs.y + lhs.h;
+		}
+	}
+
+	RenderSystem::RenderSystem(entt::registry* registry, Renderer* renderer, Window* window) :
 	m_registry(registry),
-	m_renderer(renderer)
+	m_renderer(renderer),
+	m_window(window),
+	m_nextOrder(0),
+	m_isSortDirty(true)
+	{
+		m_registry->on_construct<GraphicsComponent>().connect<&RenderSystem::OnGraphicsConstruct>(this);
+		m_registry->on_destroy<GraphicsComponent>().connect<&RenderSystem::OnGraphicsDestroy>(this);
+		m_registry->on_update<GraphicsComponent>().connect<&RenderSystem::OnGraphicsUpdate>(this);
+
+		// Les entités créées avant le système doivent aussi être dessinées
+		for (entt::entity entity : m_registry->view<GraphicsComponent>())
+			m_pendingAdditions.push_back(entity);
+	}
+
+	RenderSystem::~RenderSystem()
 	{
+		m_registry->on_construct<GraphicsComponent>().disconnect(this);
+		m_registry->on_destroy<GraphicsComponent>().disconnect(this);
+		m_registry->on_update<GraphicsComponent>().disconnect(this);
+	}
+
+	const RenderSystem::CullingStats& RenderSystem::GetCullingStats() const
+	{
+		return m_cullingStats;
 	}
 
 	void RenderSystem::Render(float)
 	{
-		Transform camera = Transform();
+		Vector2i windowSize = m_window->GetSize();
+		SDL_FRect screenRect{ 0.f, 0.f, static_cast<float>(windowSize.x), static_cast<float>(windowSize.y) };
+
+		// On récupère la matrice de vue une seule fois par frame (elle est mise en cache par le Transform)
+		Affine2f viewMatrix = Affine2f::Identity();
+		SDL_FRect cameraRect = screenRect;
 		auto cameraView = m_registry->view<Transform, CameraComponent>();
 		for (entt::entity entity : cameraView)
 		{
-			camera = cameraView.get<Transform>(entity);
+			const Transform& cameraTransform = cameraView.get<Transform>(entity);
+			viewMatrix = cameraTransform.WorldToLocalMatrix();
+			cameraRect = SpatialHash::ComputeWorldBounds(cameraTransform.LocalToWorldMatrix(), screenRect);
+		}
+
+		UpdateDrawList();
+
+		m_cullingStats = CullingStats{};
+
+		m_renderer->BeginBatch();
+
+		for (DrawEntry& entry : m_drawList)
+		{
+			if (!entry.renderable)
+				continue;
+
+			// Le Transform peut être ajouté après le GraphicsComponent, on ne garde donc pas de pointeur dessus
+			const Transform* transform = m_registry->try_get<Transform>(entry.entity);
+			if (!transform)
+				continue;
+
+			const Affine2f& worldMatrix = transform->LocalToWorldMatrix();
+			if (!Overlaps(SpatialHash::ComputeWorldBounds(worldMatrix, entry.renderable->GetBounds()), cameraRect))
+			{
+				m_cullingStats.culledCount++;
+				continue;
+			}
+
+			m_cullingStats.visibleCount++;
+
+			Affine2f transformMatrix = viewMatrix * worldMatrix;
+			entry.renderable->RenderInstance(*m_renderer, transformMatrix, entry.cache);
+		}
+
+		m_renderer->EndBatch();
+	}
+
+	void RenderSystem::OnGraphicsConstruct(entt::registry& /*registry*/, entt::entity entity)
+	{
+		m_pendingAdditions.push_back(entity);
+	}
+
+	void RenderSystem::OnGraphicsDestroy(entt::registry& /*registry*/, entt::entity entity)
+	{
+		m_pendingRemovals.push_back(entity);
+	}
+
+	void RenderSystem::OnGraphicsUpdate(entt::registry& /*registry*/, entt::entity entity)
+	{
+		// Le layer ou la texture a pu changer sans que le renderable ne soit remplacé
+		m_pendingRefreshes.push_back(entity);
+	}
+
+	void RenderSystem::RefreshEntry(DrawEntry& entry, const IRenderable* renderable)
+	{
+		int layer = (renderable) ? renderable->GetLayer() : 0;
+		const Texture* texture = (renderable) ? renderable->GetTexture() : nullptr;
+
+		// Les régions d'une même page d'atlas partagent le même SDL_Texture, c'est donc la page qui sert de clé de tri
+		std::uint64_t textureId = (texture) ? texture->GetAtlasPage()->GetId() : 0;
+
+		if (layer != entry.layer || textureId != entry.textureId)
+			m_isSortDirty = true;
+
+		// Le cache appartenait à l'ancien renderable : inutile de garder sa mémoire
+		if (renderable != entry.renderable)
+			entry.cache = RenderCache{};
+
+		entry.renderable = renderable;
+		entry.layer = layer;
+		entry.textureId = textureId;
+	}
+
+	void RenderSystem::UpdateDrawList()
+	{
+		// Les suppressions sont traitées avant les ajouts : une entité détruite puis recréée avec le même identifiant
+		// dans la même frame doit rester dans la liste
+		if (!m_pendingRemovals.empty())
+		{
+			std::sort(m_pendingRemovals.begin(), m_pendingRemovals.end());
+			std::erase_if(m_drawList, [&](const DrawEntry& entry)
+			{
+				return std::binary_search(m_pendingRemovals.begin(), m_pendingRemovals.end(), entry.entity);
+			});
+
+			m_pendingRemovals.clear();
+		}
+
+		if (!m_pendingAdditions.empty())
+		{
+			std::sort(m_pendingAdditions.begin(), m_pendingAdditions.end());
+			m_pendingAdditions.erase(std::unique(m_pendingAdditions.begin(), m_pendingAdditions.end()), m_pendingAdditions.end());
+
+			for (entt::entity entity : m_pendingAdditions)
+			{
+				if (!m_registry->valid(entity) || !m_registry->all_of<GraphicsComponent>(entity))
+					continue;
+
+				DrawEntry& entry = m_drawList.emplace_back();
+				entry.entity = entity;
+				entry.renderable = nullptr;
+				entry.textureId = 0;
+				entry.layer = 0;
+				entry.order = m_nextOrder++;
+			}
+
+			m_pendingAdditions.clear();
+			m_isSortDirty = true;
 		}
 
-		auto view = m_registry->view<Transform, GraphicsComponent>();
-		size_t viewSize = view.size_hint();
+		// Seules les entités patchées sont rafraîchies entièrement (layer et texture)
+		std::sort(m_pendingRefreshes.begin(), m_pendingRefreshes.end());
+		m_pendingRefreshes.erase(std::unique(m_pendingRefreshes.begin(), m_pendingRefreshes.end()), m_pendingRefreshes.end());
+
+		// Le renderable est généralement assigné après l'emplace du composant (sans patch),
+		// on vérifie donc à chaque frame que le pointeur mis en cache est toujours le bon
+		for (DrawEntry& entry : m_drawList)
+		{
+			const IRenderable* renderable = m_registry->get<GraphicsComponent>(entry.entity).m_renderable.get();
+			if (renderable != entry.renderable || (!m_pendingRefreshes.empty() && std::binary_search(m_pendingRefreshes.begin(), m_pendingRefreshes.end(), entry.entity)))
+				RefreshEntry(entry, renderable);
+		}
 
-		std::vector<std::tuple<Transform*, GraphicsComponent*>> sortedView;
-		sortedView.resize(viewSize);
+		m_pendingRefreshes.clear();
 
-		size_t i = 0;
-		for (auto&& [entity, transform, graphics] : view.each())
+		if (m_isSortDirty)
 		{
-			sortedView[i++] = std::tuple<Transform*, GraphicsComponent*>(&transform, &graphics);
+			SortDrawList();
+			m_isSortDirty = false;
 		}
+	}
+
+	void RenderSystem::SortDrawList()
+	{
+		if (m_drawList.size() < 2)
+			return;
+
+		auto [minIt, maxIt] = std::minmax_element(m_drawList.begin(), m_drawList.end(), [](const DrawEntry& lhs, const DrawEntry& rhs)
+		{
+			return lhs.layer < rhs.layer;
+		});
+
+		int minLayer = minIt->layer;
+		int maxLayer = maxIt->layer;
+
+		if (maxLayer - minLayer <= MaxBucketedLayerRange)
+		{
+			// Tri par dénombrement (stable) sur le layer, sans allocation une fois les tampons dimensionnés
+			std::size_t bucketCount = static_cast<std::size_t>(maxLayer - minLayer) + 1;
+			m_layerOffsets.assign(bucketCount + 1, 0);
+
+			for (const DrawEntry& entry : m_drawList)
+				m_layerOffsets[static_cast<std::size_t>(entry.layer - minLayer) + 1]++;
+
+			for (std::size_t i = 1; i <= bucketCount; ++i)
+				m_layerOffsets[i] += m_layerOffsets[i - 1];
 
-		std::sort(sortedView.begin(), sortedView.end(), [](std::tuple<Transform*, GraphicsComponent*>& lhs, std::tuple<Transform*, GraphicsComponent*>& rhs)
+			m_sortBuffer.resize(m_drawList.size());
+			for (DrawEntry& entry : m_drawList)
+				m_sortBuffer[m_layerOffsets[static_cast<std::size_t>(entry.layer - minLayer)]++] = std::move(entry);
+
+			std::swap(m_drawList, m_sortBuffer);
+		}
+		else
+		{
+			std::sort(m_drawList.begin(), m_drawList.end(), [](const DrawEntry& lhs, const DrawEntry& rhs)
 			{
-				GraphicsComponent* left = get<1>(lhs);
-				GraphicsComponent* right = get<1>(rhs);
-
-				if (!left || !right)
-				{
-					return false;
-				}
-				
-				return left->m_renderable->GetLayer() < right->m_renderable->GetLayer();
+				if (lhs.layer != rhs.layer)
+					return lhs.layer < rhs.layer;
+
+				return lhs.order < rhs.order;
 			});
+		}
 
-		for (auto&& [transform, graphic] : sortedView)
+		// Clé secondaire : au sein d'un même layer, on regroupe les textures identiques pour maximiser le batching du Renderer,
+		// l'ordre d'insertion départage les égalités pour garder un tri stable sans le tampon de std::stable_sort
+		auto layerBegin = m_drawList.begin();
+		while (layerBegin != m_drawList.end())
 		{
-			Matrixf transformMatrix =  camera.WorldToLocalMatrix() * transform->LocalToWorldMatrix();
-			graphic->m_renderable->Render(*m_renderer, transformMatrix);
+			auto layerEnd = std::find_if(layerBegin, m_drawList.end(), [&](const DrawEntry& entry) { return entry.layer != layerBegin->layer; });
+
+			std::sort(layerBegin, layerEnd, [](const DrawEntry& lhs, const DrawEntry& rhs)
+			{
+				if (lhs.textureId != rhs.textureId)
+					return lhs.textureId < rhs.textureId;
+
+				return lhs.order < rhs.order;
+			});
+
+			layerBegin = layerEnd;
 		}
 	}
-}
\ No newline at end of file
+}
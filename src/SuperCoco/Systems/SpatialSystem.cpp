@@ -0,0 +1,128 @@
+#include <SuperCoco/Systems/SpatialSystem.hpp>
+#include <SuperCoco/Components/GraphicsComponent.hpp>
+#include <SuperCoco/Renderable.hpp>
+#include <SuperCoco/Transform.hpp>
+#include <SuperCoco/Vector2.hpp>
+#include <algorithm>
+
+namespace Sce
+{
+	SpatialSystem::SpatialSystem(entt::registry* registry, float cellSize) :
+	m_spatialHash(cellSize),
+	m_registry(registry)
+	{
+		m_registry->on_construct<GraphicsComponent>().connect<&SpatialSystem::MarkDirty>(this);
+		m_registry->on_update<GraphicsComponent>().connect<&SpatialSystem::MarkDirty>(this);
+		m_registry->on_destroy<GraphicsComponent>().connect<&SpatialSystem::MarkDirty>(this);
+		m_registry->on_construct<Transform>().connect<&SpatialSystem::MarkDirty>(this);
+		m_registry->on_destroy<Transform>().connect<&SpatialSystem::MarkDirty>(this);
+
+		for (entt::entity entity : m_registry->view<GraphicsComponent>())
+			m_dirtyEntities.push_back(entity);
+	}
+
+	SpatialSystem::~SpatialSystem()
+	{
+		m_registry->on_construct<GraphicsComponent>().disconnect(this);
+		m_registry->on_update<GraphicsComponent>().disconnect(this);
+		m_registry->on_destroy<GraphicsComponent>().disconnect(this);
+		m_registry->on_construct<Transform>().disconnect(this);
+		m_registry->on_destroy<Transform>().disconnect(this);
+	}
+
+	const SpatialHash& SpatialSystem::GetSpatialHash() const
+	{
+		return m_spatialHash;
+	}
+
+	entt::entity SpatialSystem::PickEntity(const Vector2f& worldPosition) const
+	{
+		// Vecteur local : PickEntity est const et peut être appelé depuis plusieurs endroits (éditeur, survol) sans état partagé
+		std::vector<entt::entity> candidates;
+		m_spatialHash.QueryPoint(worldPosition, candidates);
+
+		entt::entity pickedEntity = entt::null;
+		int pickedLayer = 0;
+		for (entt::entity entity : candidates)
+		{
+			int layer = m_spatialHash.GetLayer(entity);
+			if (pickedEntity != entt::null && layer <= pickedLayer)
+				continue;
+
+			// L'index n'est mis à jour qu'une fois par frame, l'entité a pu être détruite ou modifiée depuis
+			if (!m_registry->valid(entity))
+				continue;
+
+			const Transform* transform = m_registry->try_get<Transform>(entity);
+			const GraphicsComponent* graphics = m_registry->try_get<GraphicsComponent>(entity);
+			if (!transform || !graphics || !graphics->m_renderable)
+				continue;
+
+			// La boîte englobante en monde est plus large que le renderable dès qu'il est tourné, on vérifie donc dans son espace local
+			const IRenderable* renderable = graphics->m_renderable.get();
+			Vector2f localPos = transform->WorldToLocalPoint(worldPosition);
+			SDL_FRect bounds = renderable->GetBounds();
+			if (localPos.x >= bounds.x && localPos.y >= bounds.y &&
+				localPos.x < bounds.x + bounds.w && localPos.y < bounds.y + bounds.h)
+			{
+				pickedEntity = entity;
+				pickedLayer = layer;
+			}
+		}
+
+		return pickedEntity;
+	}
+
+	void SpatialSystem::QueryPoint(const Vector2f& point, std::vector<entt::entity>& results) const
+	{
+		m_spatialHash.QueryPoint(point, results);
+	}
+
+	void SpatialSystem::QueryRadius(const Vector2f& center, float radius, std::vector<entt::entity>& results) const
+	{
+		m_spatialHash.QueryRadius(center, radius, results);
+	}
+
+	void SpatialSystem::QueryRect(const SDL_FRect& rect, std::vector<entt::entity>& results) const
+	{
+		m_spatialHash.QueryRect(rect, results);
+	}
+
+	void SpatialSystem::Update(std::span<const entt::entity> movedEntities)
+	{
+		for (entt::entity entity : movedEntities)
+		{
+			if (m_registry->all_of<GraphicsComponent>(entity))
+				m_dirtyEntities.push_back(entity);
+		}
+
+		if (m_dirtyEntities.empty())
+			return;
+
+		// Une entité peut être signalée plusieurs fois dans la frame (déplacée puis patchée, rendue à un pool puis réactivée...)
+		std::sort(m_dirtyEntities.begin(), m_dirtyEntities.end());
+		m_dirtyEntities.erase(std::unique(m_dirtyEntities.begin(), m_dirtyEntities.end()), m_dirtyEntities.end());
+
+		for (entt::entity entity : m_dirtyEntities)
+		{
+			// Les signaux de destruction sont émis avant le retrait du composant : c'est ici qu'on constate qu'il n'est plus là
+			const GraphicsComponent* graphics = (m_registry->valid(entity)) ? m_registry->try_get<GraphicsComponent>(entity) : nullptr;
+			const Transform* transform = (graphics) ? m_registry->try_get<Transform>(entity) : nullptr;
+			if (!transform || !graphics->m_renderable)
+			{
+				m_spatialHash.Remove(entity);
+				continue;
+			}
+
+			const IRenderable* renderable = graphics->m_renderable.get();
+			m_spatialHash.Insert(entity, SpatialHash::ComputeWorldBounds(transform->LocalToWorldMatrix(), renderable->GetBounds()), renderable->GetLayer());
+		}
+
+		m_dirtyEntities.clear();
+	}
+
+	void SpatialSystem::MarkDirty(entt::registry& /*registry*/, entt::entity entity)
+	{
+		m_dirtyEntities.push_back(entity);
+	}
+}
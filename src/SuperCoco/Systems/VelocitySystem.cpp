@@ -1,13 +1,17 @@
 #include <SuperCoco/Systems/VelocitySystem.hpp>
+#include <SuperCoco/Components/HierarchyComponent.hpp>
+#include <SuperCoco/Components/PoolComponents.hpp>
 #include <SuperCoco/Components/VelocityComponent.hpp>
+#include <SuperCoco/ParallelForEach.hpp>
 #include <SuperCoco/Transform.hpp>
 
 namespace Sce
 {
 	VelocitySystem* VelocitySystem::s_instance = nullptr;
 
-	VelocitySystem::VelocitySystem(entt::registry* registry) :
-	m_registry(registry)
+	VelocitySystem::VelocitySystem(entt::registry* registry, ThreadPool* threadPool) :
+	m_registry(registry),
+	m_threadPool(threadPool)
 	{
 		if (!s_instance)
 			s_instance = this;
@@ -22,8 +26,7 @@ namespace Sce
 
 	void VelocitySystem::ApplyVelocity(float deltaTime)
 	{
-		auto view = m_registry->view<Transform, VelocityComponent>();
-		for (auto&& [entity, transform, velocity] : view.each())
+		auto Integrate = [deltaTime](Transform& transform, VelocityComponent& velocity)
 		{
 			transform.Translate(velocity.linearVel * deltaTime);
 
@@ -34,6 +37,35 @@ namespace Sce
 				transform.SetPosition(pos);
 				velocity.linearVel.y = 0.f;
 			}
+		};
+
+		auto view = m_registry->view<Transform, VelocityComponent>(entt::exclude<InactiveComponent>);
+		if (!m_threadPool)
+		{
+			for (auto&& [entity, transform, velocity] : view.each())
+				Integrate(transform, velocity);
+
+			return;
+		}
+
+		// Déplacer un Transform invalide les matrices de ses descendants : seules les entités hors hiérarchie
+		// (sans parent ni enfant) sont traitées en parallèle, les autres le sont ensuite sur le thread appelant
+		auto IsInHierarchy = [&](entt::entity entity)
+		{
+			const HierarchyComponent* hierarchy = m_registry->try_get<HierarchyComponent>(entity);
+			return hierarchy && (hierarchy->parent != entt::null || hierarchy->firstChild != entt::null);
+		};
+
+		ParallelForEach(*m_threadPool, view, [&](entt::entity entity, Transform& transform, VelocityComponent& velocity)
+		{
+			if (!IsInHierarchy(entity))
+				Integrate(transform, velocity);
+		});
+
+		for (auto&& [entity, transform, velocity] : view.each())
+		{
+			if (IsInHierarchy(entity))
+				Integrate(transform, velocity);
 		}
 	}
 
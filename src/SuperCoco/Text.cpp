@@ -2,7 +2,7 @@
 #include <SuperCoco/Font.hpp>
 #include <SuperCoco/Texture.hpp>
 #include <SuperCoco/Renderer.hpp>
-#include <SuperCoco/Matrix.hpp>
+#include <SuperCoco/Affine2.hpp>
 #include <SuperCoco/ResourceManager.hpp>
 #include <nlohmann/json.hpp>
 #include <imgui.h>
@@ -22,73 +22,29 @@ namespace Sce
 	m_color(color),
 	m_origin(origin)
 	{
-		if (m_font && !m_text.empty())
-			m_texture = std::make_unique<Texture>(m_font->GenerateText(m_text, m_color));
+		UpdateMesh();
 	}
 
 	Text::Text(Text&& text) noexcept
 	{
-		m_texture = std::move(text.m_texture);
+		m_mesh = std::move(text.m_mesh);
 		m_font = std::move(text.m_font);
 		m_color = text.m_color;
 		m_text = text.m_text;
 		m_origin = text.m_origin;
 	}
 
-	void Text::Render(Renderer& renderer, const Matrixf& transformMatrix) const
+	void Text::Render(Renderer& renderer, const Affine2f& transformMatrix) const
 	{
-		SDL_Rect texRect{ 0, 0, 1, 1 };
-		if (m_texture)
-			texRect = m_texture->GetRect();
-
-		Vector2f originShift{ texRect.w * m_origin.x, texRect.h * m_origin.y };
-
-		Vector2f topLeft = transformMatrix * Vector2f(-originShift.x, -originShift.y);
-		Vector2f topRight = transformMatrix * Vector2f(texRect.w - originShift.x, -originShift.y);
-		Vector2f bottomLeft = transformMatrix * Vector2f(-originShift.x, texRect.h - originShift.y);
-		Vector2f bottomRight = transformMatrix * Vector2f(texRect.w - originShift.x, texRect.h - originShift.y);
-
-		float invWidth = 1.f / texRect.w;
-		float invHeight = 1.f / texRect.h;
-
-		SDL_Vertex vertices[4];
-		vertices[0].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[0].position = SDL_FPoint{ topLeft.x, topLeft.y };
-		vertices[0].tex_coord = SDL_FPoint{ 0.f, 0.f };
-
-		vertices[1].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[1].position = SDL_FPoint{ topRight.x, topRight.y };
-		vertices[1].tex_coord = SDL_FPoint{ texRect.w * invWidth, 0.f };
-
-		vertices[2].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[2].position = SDL_FPoint{ bottomLeft.x, bottomLeft.y };
-		vertices[2].tex_coord = SDL_FPoint{ 0.f, texRect.h * invHeight };
-
-		vertices[3].color = SDL_Color{ 255, 255, 255, 255 };
-		vertices[3].position = SDL_FPoint{ bottomRight.x, bottomRight.y };
-		vertices[3].tex_coord = SDL_FPoint{ texRect.w * invWidth, texRect.h * invHeight };
-
-		int indices[6] = { 0, 1, 2, 2, 1, 3 };
-
-		if (m_texture)
-			renderer.RenderGeometry(*m_texture.get(), vertices, 4, indices, 6);
-		else
-			renderer.RenderGeometry(vertices, 4, indices, 6);
+		m_mesh.Render(renderer, transformMatrix);
 	}
 
 	SDL_FRect Text::GetBounds() const
 	{
-		if (!m_texture)
+		if (m_mesh.IsEmpty())
 			return SDL_FRect(0, 0, 20, 20);
 
-		SDL_Rect rect = m_texture->GetRect();
-		SDL_FRect bounds = {
-			0.f, 0.f, float(rect.w), float(rect.h)
-		};
-
-		bounds.x -= rect.w * m_origin.x;
-		bounds.y -= rect.h * m_origin.y;
-		return bounds;
+		return m_mesh.GetBounds();
 	}
 
 	int Text::GetLayer() const
@@ -96,6 +52,11 @@ namespace Sce
 		return 10;
 	}
 
+	const Texture* Text::GetTexture() const
+	{
+		return m_mesh.GetTexture();
+	}
+
 	nlohmann::json Text::Serialize() const
 	{
 		return nlohmann::json();
@@ -109,24 +70,33 @@ namespace Sce
 	void Text::SetText(const std::string& txt)
 	{
 		m_text = txt;
-		m_texture = std::make_unique<Texture>(m_font->GenerateText(m_text, m_color));
+		UpdateMesh();
 	}
 
 	void Text::SetFont(const std::shared_ptr<Font> font)
 	{
 		m_font = font;
-		m_texture = std::make_unique<Texture>(m_font->GenerateText(m_text, m_color));
+		UpdateMesh();
 	}
 
 	void Text::SetOrigin(const Vector2f& origin)
 	{
 		m_origin = origin;
+		UpdateMesh();
 	}
 
 	void Text::SetColor(SDL_Color color)
 	{
 		m_color = color;
-		m_texture = std::make_unique<Texture>(m_font->GenerateText(m_text, m_color));
+		m_mesh.SetColor(m_color);
+	}
+
+	void Text::UpdateMesh()
+	{
+		if (m_font && !m_text.empty())
+			m_mesh.Build(*m_font, m_text, m_color, m_origin);
+		else
+			m_mesh.Clear();
 	}
 
 	void Text::PopulateInspector(WorldEditor& worldEditor)
@@ -141,7 +111,7 @@ namespace Sce
 		{
 			try
 			{
-				m_font = ResourceManager::Instance().GetFont(m_fontEditor, m_sizeEditor);
+				SetFont(ResourceManager::Instance().GetFont(m_fontEditor, m_sizeEditor));
 				m_loadFail = false;
 			}
 			catch (const std::exception&)
@@ -155,12 +125,12 @@ namespace Sce
 
 		if (ImGui::ColorEdit4("Color", m_colorEditor))
 		{
-			m_color = { Uint8(255 * m_colorEditor[0]), Uint8(255 * m_colorEditor[1]), Uint8(255 * m_colorEditor[2]), Uint8(255 * m_colorEditor[3]) };
+			SetColor({ Uint8(255 * m_colorEditor[0]), Uint8(255 * m_colorEditor[1]), Uint8(255 * m_colorEditor[2]), Uint8(255 * m_colorEditor[3]) });
 		}
 
 		float originArray[2] = { m_origin.x, m_origin.y };
 		if (ImGui::InputFloat2("Origin", originArray))
-			m_origin = Vector2f{ originArray[0], originArray[1] };
+			SetOrigin(Vector2f{ originArray[0], originArray[1] });
 	}
 
 }
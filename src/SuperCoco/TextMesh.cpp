@@ -0,0 +1,184 @@
+#include <SuperCoco/TextMesh.hpp>
+#include <SuperCoco/Affine2.hpp>
+#include <SuperCoco/Font.hpp>
+#include <SuperCoco/Renderer.hpp>
+#include <SuperCoco/Texture.hpp>
+#include <SuperCoco/VertexTransform.hpp>
+#include <algorithm>
+#include <cstdint>
+
+namespace Sce
+{
+	namespace
+	{
+		// Décode le prochain point de code UTF-8, les séquences invalides donnent U+FFFD
+		std::uint32_t DecodeUtf8(const std::string& text, std::size_t& offset)
+		{
+			auto byte = [&](std::size_t i) { return static_cast<std::uint8_t>(text[i]); };
+
+			std::uint8_t lead = byte(offset++);
+			if (lead < 0x80)
+				return lead;
+
+			std::size_t continuationCount;
+			std::uint32_t codepoint;
+			if ((lead & 0xE0) == 0xC0)
+			{
+				continuationCount = 1;
+				codepoint = lead & 0x1F;
+			}
+			else if ((lead & 0xF0) == 0xE0)
+			{
+				continuationCount = 2;
+				codepoint = lead & 0x0F;
+			}
+			else if ((lead & 0xF8) == 0xF0)
+			{
+				continuationCount = 3;
+				codepoint = lead & 0x07;
+			}
+			else
+				return 0xFFFD;
+
+			for (std::size_t i = 0; i < continuationCount; ++i)
+			{
+				if (offset >= text.size() || (byte(offset) & 0xC0) != 0x80)
+					return 0xFFFD;
+
+				codepoint = (codepoint << 6) | (byte(offset++) & 0x3F);
+			}
+
+			return codepoint;
+		}
+	}
+
+	void TextMesh::Build(Font& font, const std::string& text, const SDL_Color& color, const Vector2f& origin)
+	{
+		Clear();
+
+		int lineSkip = font.GetLineSkip();
+		int lineHeight = font.GetLineHeight();
+
+		float penX = 0.f;
+		float penY = 0.f;
+		float width = 0.f;
+		std::uint32_t previousCodepoint = 0;
+
+		std::size_t offset = 0;
+		while (offset < text.size())
+		{
+			std::uint32_t codepoint = DecodeUtf8(text, offset);
+			if (codepoint == '\n')
+			{
+				width = std::max(width, penX);
+				penX = 0.f;
+				penY += lineSkip;
+				previousCodepoint = 0;
+				continue;
+			}
+
+			if (previousCodepoint != 0)
+				penX += font.GetKerning(previousCodepoint, codepoint);
+
+			previousCodepoint = codepoint;
+
+			const Font::Glyph& glyph = font.GetGlyph(codepoint);
+			if (glyph.rect.w > 0 && glyph.rect.h > 0)
+			{
+				const std::shared_ptr<Texture>& page = font.GetGlyphPage(glyph.pageIndex);
+				if (m_runs.empty() || m_runs.back().page != page)
+					m_runs.push_back(Run{ page, m_vertices.size(), 0, m_indices.size(), 0 });
+
+				Run& run = m_runs.back();
+
+				// Indices relatifs au premier vertex du run, envoyé séparément
+				int firstIndex = static_cast<int>(run.vertexCount);
+				for (int index : { 0, 1, 2, 2, 1, 3 })
+					m_indices.push_back(firstIndex + index);
+
+				float glyphWidth = float(glyph.rect.w);
+				float glyphHeight = float(glyph.rect.h);
+				m_positions.emplace_back(penX, penY);
+				m_positions.emplace_back(penX + glyphWidth, penY);
+				m_positions.emplace_back(penX, penY + glyphHeight);
+				m_positions.emplace_back(penX + glyphWidth, penY + glyphHeight);
+
+				SDL_FRect texCoords = page->GetTexCoords(glyph.rect);
+				SDL_Vertex vertex;
+				vertex.position = SDL_FPoint{ 0.f, 0.f };
+				vertex.color = color;
+
+				vertex.tex_coord = SDL_FPoint{ texCoords.x, texCoords.y };
+				m_vertices.push_back(vertex);
+				vertex.tex_coord = SDL_FPoint{ texCoords.x + texCoords.w, texCoords.y };
+				m_vertices.push_back(vertex);
+				vertex.tex_coord = SDL_FPoint{ texCoords.x, texCoords.y + texCoords.h };
+				m_vertices.push_back(vertex);
+				vertex.tex_coord = SDL_FPoint{ texCoords.x + texCoords.w, texCoords.y + texCoords.h };
+				m_vertices.push_back(vertex);
+
+				run.vertexCount += 4;
+				run.indexCount += 6;
+			}
+
+			penX += glyph.advance;
+		}
+
+		width = std::max(width, penX);
+		float height = penY + lineHeight;
+
+		Vector2f originShift{ width * origin.x, height * origin.y };
+		for (Vector2f& position : m_positions)
+			position -= originShift;
+
+		m_bounds = SDL_FRect{ -originShift.x, -originShift.y, width, height };
+	}
+
+	void TextMesh::Clear()
+	{
+		m_runs.clear();
+		m_positions.clear();
+		m_indices.clear();
+		m_vertices.clear();
+		m_bounds = SDL_FRect{ 0.f, 0.f, 0.f, 0.f };
+	}
+
+	SDL_FRect TextMesh::GetBounds() const
+	{
+		return m_bounds;
+	}
+
+	const Texture* TextMesh::GetTexture() const
+	{
+		if (m_runs.empty())
+			return nullptr;
+
+		return m_runs.front().page.get();
+	}
+
+	bool TextMesh::IsEmpty() const
+	{
+		return m_runs.empty();
+	}
+
+	void TextMesh::Render(Renderer& renderer, const Affine2f& transformMatrix) const
+	{
+		if (m_vertices.empty())
+			return;
+
+		TransformPoints(transformMatrix, m_positions.data(), m_vertices.data(), m_vertices.size());
+
+		for (const Run& run : m_runs)
+		{
+			renderer.RenderGeometry(*run.page,
+				&m_vertices[run.firstVertex], static_cast<int>(run.vertexCount),
+				&m_indices[run.firstIndex], static_cast<int>(run.indexCount));
+		}
+	}
+
+	void TextMesh::SetColor(const SDL_Color& color)
+	{
+		for (SDL_Vertex& vertex : m_vertices)
+			vertex.color = color;
+	}
+}
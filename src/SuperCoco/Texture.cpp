@@ -1,30 +1,76 @@
 #include <SuperCoco/Texture.hpp>
 #include <SuperCoco/Renderer.hpp>
 #include <SuperCoco/Surface.hpp>
+#include <atomic>
 #include <stdexcept>
 #include <fmt/core.h>
 
 namespace Sce
 {
-	
-	Texture::Texture(SDL_Texture* texture) :
-	m_texture(texture)
+	namespace
 	{
+		// Les textures peuvent être créées sur les threads de chargement du ResourceManager
+		std::uint64_t NextTextureId()
+		{
+			static std::atomic<std::uint64_t> s_nextId = 1;
+			return s_nextId++;
+		}
+	}
 
+	Texture::Texture(SDL_Texture* texture) :
+	m_texture(texture),
+	m_region{ 0, 0, 0, 0 },
+	m_id(NextTextureId())
+	{
+		// La taille est mise en cache : GetRect est appelé par chaque renderable à chaque frame
+		SDL_QueryTexture(m_texture, nullptr, nullptr, &m_region.w, &m_region.h);
+		m_pageWidth = m_region.w;
+		m_pageHeight = m_region.h;
 	}
 
 	Texture::~Texture()
 	{
-		if (m_texture)
+		// Une région ne possède pas le SDL_Texture, il appartient à sa page
+		if (m_texture && !m_page)
 			SDL_DestroyTexture(m_texture);
 	}
 
 	Texture::Texture(Texture&& texture) noexcept :
-	m_texture(texture.m_texture)
+	Asset(std::move(texture)),
+	m_page(std::move(texture.m_page)),
+	m_texture(texture.m_texture),
+	m_region(texture.m_region),
+	m_id(texture.m_id),
+	m_pageWidth(texture.m_pageWidth),
+	m_pageHeight(texture.m_pageHeight)
 	{
 		texture.m_texture = nullptr;
 	}
 
+	std::size_t Texture::GetMemorySize() const
+	{
+		// La mémoire d'une région est comptée avec sa page
+		if (!m_texture || m_page)
+			return 0;
+
+		Uint32 format;
+		if (SDL_QueryTexture(m_texture, &format, nullptr, nullptr, nullptr) != 0)
+			return 0;
+
+		return std::size_t(SDL_BYTESPERPIXEL(format)) * m_pageWidth * m_pageHeight;
+	}
+
+	Texture Texture::Create(const Renderer& renderer, int width, int height)
+	{
+		SDL_Texture* tex = SDL_CreateTexture(renderer.GetHandle(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, width, height);
+		if (!tex)
+			throw std::runtime_error("failed to create texture");
+
+		SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+
+		return Texture(tex);
+	}
+
 	Texture Texture::CreateFromSurface(const Renderer& renderer, const Surface& surface)
 	{
 		SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer.GetHandle(), surface.GetHandle());
@@ -34,9 +80,30 @@ namespace Sce
 		return Texture(tex);
 	}
 
+	Texture Texture::CreateRegion(std::shared_ptr<Texture> page, const SDL_Rect& region, std::string filepath)
+	{
+		if (!page || page->IsAtlasRegion())
+			throw std::runtime_error("a texture region must be created from a page texture");
+
+		Texture texture(page->m_texture);
+		texture.m_region = region;
+		texture.m_page = std::move(page);
+		texture.m_filepath = std::move(filepath);
+		texture.m_path = texture.m_filepath;
+
+		return texture;
+	}
+
 	Texture& Texture::operator=(Texture&& texture) noexcept
 	{
+		Asset::operator=(std::move(texture));
+
+		std::swap(m_page, texture.m_page);
 		std::swap(m_texture, texture.m_texture);
+		std::swap(m_region, texture.m_region);
+		std::swap(m_id, texture.m_id);
+		std::swap(m_pageWidth, texture.m_pageWidth);
+		std::swap(m_pageHeight, texture.m_pageHeight);
 		return *this;
 	}
 
@@ -45,6 +112,16 @@ namespace Sce
 		return CreateFromSurface(renderer, Surface::LoadFromFile(path));
 	}
 
+	const Texture* Texture::GetAtlasPage() const
+	{
+		return (m_page) ? m_page.get() : this;
+	}
+
+	std::uint64_t Texture::GetId() const
+	{
+		return m_id;
+	}
+
 	std::string Texture::GetPath() const
 	{
 		return m_path;
@@ -52,10 +129,35 @@ namespace Sce
 
 	SDL_Rect Texture::GetRect() const
 	{
-		SDL_Rect rect{ 0, 0 };
-		SDL_QueryTexture(m_texture, nullptr, nullptr, &rect.w, &rect.h);
+		return SDL_Rect{ 0, 0, m_region.w, m_region.h };
+	}
 
-		return rect;
+	const SDL_Rect& Texture::GetRegion() const
+	{
+		return m_region;
 	}
-}
 
+	SDL_FRect Texture::GetTexCoords(const SDL_Rect& rect) const
+	{
+		float invWidth = 1.f / m_pageWidth;
+		float invHeight = 1.f / m_pageHeight;
+
+		return SDL_FRect{
+			(m_region.x + rect.x) * invWidth,
+			(m_region.y + rect.y) * invHeight,
+			rect.w * invWidth,
+			rect.h * invHeight
+		};
+	}
+
+	bool Texture::IsAtlasRegion() const
+	{
+		return m_page != nullptr;
+	}
+
+	void Texture::Update(const Surface& surface, const SDL_Rect& rect)
+	{
+		if (SDL_UpdateTexture(m_texture, &rect, surface.GetPixels(), surface.GetPitch()) != 0)
+			throw std::runtime_error(SDL_GetError());
+	}
+}
@@ -0,0 +1,296 @@
+#include <SuperCoco/TextureAtlas.hpp>
+#include <SuperCoco/JsonSerializer.hpp>
+#include <SuperCoco/Surface.hpp>
+#include <SuperCoco/Texture.hpp>
+#include <fmt/color.h>
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <unordered_set>
+#include <stdexcept>
+
+namespace Sce
+{
+	constexpr unsigned int ManifestVersion = 1;
+
+	TextureAtlas::TextureAtlas(Renderer* renderer, int pageSize, int padding) :
+	m_renderer(renderer),
+	m_padding(padding),
+	m_pageSize(pageSize)
+	{
+	}
+
+	std::shared_ptr<Texture> TextureAtlas::Find(const std::string& name) const
+	{
+		auto it = m_regions.find(name);
+		if (it == m_regions.end())
+			return nullptr;
+
+		return it->second;
+	}
+
+	std::size_t TextureAtlas::GetMemorySize() const
+	{
+		std::size_t memorySize = 0;
+		for (const Page& page : m_pages)
+			memorySize += page.texture->GetMemorySize();
+
+		return memorySize;
+	}
+
+	std::size_t TextureAtlas::GetPageCount() const
+	{
+		return m_pages.size();
+	}
+
+	int TextureAtlas::GetPageSize() const
+	{
+		return m_pageSize;
+	}
+
+	std::shared_ptr<Texture> TextureAtlas::Insert(const std::string& name, const Surface& surface)
+	{
+		if (std::shared_ptr<Texture> region = Find(name))
+			return region;
+
+		std::shared_ptr<Texture> texture = AllocateRegion(name, surface);
+		if (texture)
+			m_regions.emplace(name, texture);
+
+		return texture;
+	}
+
+	bool TextureAtlas::Reload(const std::string& name, const Surface& surface)
+	{
+		std::shared_ptr<Texture> region = Find(name);
+		if (!region || !region->IsAtlasRegion())
+			return false;
+
+		const SDL_Rect& currentRegion = region->GetRegion();
+		if (currentRegion.w == surface.GetWidth() && currentRegion.h == surface.GetHeight())
+		{
+			region->Update(surface.ConvertToRGBA32(), currentRegion);
+			return true;
+		}
+
+		// L'ancien emplacement reste inutilisé, les packers ne savent pas libérer de place
+		std::shared_ptr<Texture> newRegion = AllocateRegion(name, surface);
+		if (!newRegion)
+			return false;
+
+		*region = std::move(*newRegion);
+		return true;
+	}
+
+	std::size_t TextureAtlas::ReleaseUnusedPages()
+	{
+		// L'atlas détient toujours une référence sur ses régions, une région n'est utilisée que si quelqu'un d'autre en a une
+		std::unordered_set<const Texture*> usedPages;
+		for (const auto& [name, region] : m_regions)
+		{
+			if (region.use_count() > 1)
+				usedPages.insert(region->GetAtlasPage());
+		}
+
+		auto IsReleasable = [&](const Page& page)
+		{
+			return page.packer && !usedPages.contains(page.texture.get());
+		};
+
+		std::unordered_set<const Texture*> releasedPages;
+		std::size_t freedBytes = 0;
+		for (const Page& page : m_pages)
+		{
+			if (IsReleasable(page))
+			{
+				releasedPages.insert(page.texture.get());
+				freedBytes += page.texture->GetMemorySize();
+			}
+		}
+
+		if (releasedPages.empty())
+			return 0;
+
+		std::erase_if(m_regions, [&](const auto& pair) { return releasedPages.contains(pair.second->GetAtlasPage()); });
+		std::erase_if(m_pages, IsReleasable);
+
+		return freedBytes;
+	}
+
+	std::shared_ptr<Texture> TextureAtlas::AllocateRegion(const std::string& name, const Surface& surface)
+	{
+		int width = surface.GetWidth();
+		int height = surface.GetHeight();
+
+		// Le padding évite que le filtrage ne fasse déborder les pixels d'une région voisine
+		if (width + m_padding > m_pageSize || height + m_padding > m_pageSize)
+			return nullptr;
+
+		std::optional<SDL_Rect> rect;
+		Page* page = nullptr;
+		for (Page& candidate : m_pages)
+		{
+			if (!candidate.packer)
+				continue;
+
+			rect = candidate.packer->Insert(width + m_padding, height + m_padding);
+			if (rect)
+			{
+				page = &candidate;
+				break;
+			}
+		}
+
+		if (!rect)
+		{
+			Page& newPage = m_pages.emplace_back();
+			newPage.texture = std::make_shared<Texture>(Texture::Create(*m_renderer, m_pageSize, m_pageSize));
+			newPage.packer.emplace(m_pageSize, m_pageSize);
+
+			// Une texture neuve n'est pas initialisée : les pixels laissés libres par le padding doivent être transparents
+			Surface clearSurface = Surface::Create(m_pageSize, m_pageSize);
+			clearSurface.FillRect(SDL_Rect{ 0, 0, m_pageSize, m_pageSize }, 0, 0, 0, 0);
+			newPage.texture->Update(clearSurface, SDL_Rect{ 0, 0, m_pageSize, m_pageSize });
+
+			rect = newPage.packer->Insert(width + m_padding, height + m_padding);
+			page = &newPage;
+		}
+
+		SDL_Rect region{ rect->x, rect->y, width, height };
+		page->texture->Update(surface.ConvertToRGBA32(), region);
+
+		return std::make_shared<Texture>(Texture::CreateRegion(page->texture, region, name));
+	}
+
+	bool TextureAtlas::BuildToFile(const std::vector<std::string>& texturePaths, const std::string& manifestPath, int pageSize, int padding)
+	{
+		std::vector<Surface> surfaces;
+		surfaces.reserve(texturePaths.size());
+		for (const std::string& texturePath : texturePaths)
+		{
+			try
+			{
+				surfaces.push_back(Surface::LoadFromFile(texturePath).ConvertToRGBA32());
+			}
+			catch (const std::exception& e)
+			{
+				fmt::print(fg(fmt::color::red), "failed to load {}: {}\n", texturePath, e.what());
+				return false;
+			}
+
+			if (surfaces.back().GetWidth() + padding > pageSize || surfaces.back().GetHeight() + padding > pageSize)
+			{
+				fmt::print(fg(fmt::color::red), "{} is too large for a {}x{} atlas page\n", texturePath, pageSize, pageSize);
+				return false;
+			}
+		}
+
+		// Placer les textures les plus hautes en premier donne une ligne d'horizon plus régulière (et moins de pages)
+		std::vector<std::size_t> order(surfaces.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs)
+		{
+			return surfaces[lhs].GetHeight() > surfaces[rhs].GetHeight();
+		});
+
+		std::vector<Surface> pages;
+		std::vector<SkylinePacker> packers;
+
+		nlohmann::ordered_json manifest;
+		manifest["Version"] = ManifestVersion;
+		manifest["PageSize"] = pageSize;
+
+		nlohmann::ordered_json& regionsDoc = manifest["Regions"];
+		for (std::size_t index : order)
+		{
+			const Surface& surface = surfaces[index];
+
+			std::optional<SDL_Rect> rect;
+			std::size_t pageIndex = 0;
+			for (; pageIndex < packers.size(); ++pageIndex)
+			{
+				rect = packers[pageIndex].Insert(surface.GetWidth() + padding, surface.GetHeight() + padding);
+				if (rect)
+					break;
+			}
+
+			if (!rect)
+			{
+				Surface& page = pages.emplace_back(Surface::Create(pageSize, pageSize));
+				page.FillRect(SDL_Rect{ 0, 0, pageSize, pageSize }, 0, 0, 0, 0);
+
+				rect = packers.emplace_back(pageSize, pageSize).Insert(surface.GetWidth() + padding, surface.GetHeight() + padding);
+			}
+
+			pages[pageIndex].Blit(surface, rect->x, rect->y);
+
+			nlohmann::ordered_json regionDoc;
+			regionDoc["Page"] = pageIndex;
+			regionDoc["Rect"] = SDL_Rect{ rect->x, rect->y, surface.GetWidth(), surface.GetHeight() };
+
+			regionsDoc[texturePaths[index]] = std::move(regionDoc);
+		}
+
+		// Les pages sont enregistrées à côté du manifeste, leur chemin y est stocké en relatif
+		std::filesystem::path manifestFile(manifestPath);
+		nlohmann::ordered_json& pagesDoc = manifest["Pages"];
+		for (std::size_t i = 0; i < pages.size(); ++i)
+		{
+			std::string pageFilename = fmt::format("{}_{}.png", manifestFile.stem().string(), i);
+			if (!pages[i].SaveToPNG((manifestFile.parent_path() / pageFilename).string()))
+			{
+				fmt::print(fg(fmt::color::red), "failed to save atlas page {}\n", pageFilename);
+				return false;
+			}
+
+			pagesDoc.push_back(pageFilename);
+		}
+
+		std::ofstream outputFile(manifestPath);
+		if (!outputFile.is_open())
+		{
+			fmt::print(fg(fmt::color::red), "failed to open {}\n", manifestPath);
+			return false;
+		}
+
+		outputFile << manifest.dump(4);
+		return true;
+	}
+
+	TextureAtlas TextureAtlas::LoadFromManifest(Renderer* renderer, const std::string& manifestPath)
+	{
+		std::ifstream inputFile(manifestPath);
+		if (!inputFile)
+			throw std::runtime_error("failed to open " + manifestPath);
+
+		nlohmann::json manifest = nlohmann::json::parse(inputFile);
+
+		unsigned int version = manifest.at("Version");
+		if (version > ManifestVersion)
+			throw std::runtime_error(fmt::format("{} has an unknown manifest version {}", manifestPath, version));
+
+		TextureAtlas atlas(renderer, manifest.at("PageSize"));
+
+		std::filesystem::path directory = std::filesystem::path(manifestPath).parent_path();
+		for (const std::string& pageFilename : manifest.at("Pages"))
+		{
+			Page& page = atlas.m_pages.emplace_back();
+			page.texture = std::make_shared<Texture>(Texture::LoadFromFile(*renderer, (directory / pageFilename).string()));
+		}
+
+		for (auto&& [name, regionDoc] : manifest.at("Regions").items())
+		{
+			std::size_t pageIndex = regionDoc.at("Page");
+			if (pageIndex >= atlas.m_pages.size())
+				throw std::runtime_error(fmt::format("{} references an invalid page for {}", manifestPath, name));
+
+			SDL_Rect rect = regionDoc.at("Rect");
+			atlas.m_regions.emplace(name, std::make_shared<Texture>(Texture::CreateRegion(atlas.m_pages[pageIndex].texture, rect, name)));
+		}
+
+		return atlas;
+	}
+}
@@ -0,0 +1,169 @@
+#include <SuperCoco/ThreadPool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace Sce
+{
+	ThreadPool::ThreadPool(std::size_t threadCount) :
+	m_isStopping(false)
+	{
+		if (threadCount == 0)
+		{
+			unsigned int hardwareThreads = std::thread::hardware_concurrency();
+			threadCount = std::max(hardwareThreads, 2u) - 1;
+		}
+
+		m_workers.reserve(threadCount);
+		for (std::size_t i = 0; i < threadCount; ++i)
+			m_workers.emplace_back(&ThreadPool::WorkerMain, this);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard lock(m_mutex);
+			m_isStopping = true;
+		}
+		m_taskAvailable.notify_all();
+
+		for (std::thread& worker : m_workers)
+			worker.join();
+	}
+
+	std::size_t ThreadPool::GetThreadCount() const
+	{
+		return m_workers.size();
+	}
+
+	void ThreadPool::ParallelFor(std::size_t count, const std::function<void(std::size_t begin, std::size_t end)>& func, std::size_t grainSize, ParallelChunking chunking)
+	{
+		if (count == 0)
+			return;
+
+		std::size_t chunkSize = std::max<std::size_t>(grainSize, 1);
+		if (chunking == ParallelChunking::Adaptive)
+		{
+			// Quelques paquets par thread pour équilibrer la charge sans multiplier les synchronisations
+			std::size_t targetChunkCount = (m_workers.size() + 1) * 4;
+			chunkSize = std::max(chunkSize, (count + targetChunkCount - 1) / targetChunkCount);
+		}
+
+		std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+		if (chunkCount == 1 || m_workers.empty())
+		{
+			func(0, count);
+			return;
+		}
+
+		// Les bornes d'un paquet ne dépendent que de son indice : seul le thread qui le traite varie d'une exécution à l'autre
+		struct Batch
+		{
+			std::atomic<std::size_t> nextChunk = 0;
+			std::condition_variable runnersDone;
+			std::exception_ptr error;
+			std::mutex mutex;
+			std::size_t pendingRunners = 0;
+		};
+
+		Batch batch;
+		auto RunChunks = [&]
+		{
+			for (;;)
+			{
+				std::size_t chunkIndex = batch.nextChunk.fetch_add(1, std::memory_order_relaxed);
+				if (chunkIndex >= chunkCount)
+					return;
+
+				std::size_t begin = chunkIndex * chunkSize;
+				try
+				{
+					func(begin, std::min(begin + chunkSize, count));
+				}
+				catch (...)
+				{
+					std::lock_guard lock(batch.mutex);
+					if (!batch.error)
+						batch.error = std::current_exception();
+				}
+			}
+		};
+
+		std::size_t runnerCount = std::min(m_workers.size(), chunkCount - 1);
+		batch.pendingRunners = runnerCount;
+		for (std::size_t i = 0; i < runnerCount; ++i)
+		{
+			Submit([&]
+			{
+				RunChunks();
+
+				std::lock_guard lock(batch.mutex);
+				if (--batch.pendingRunners == 0)
+					batch.runnersDone.notify_all();
+			});
+		}
+
+		RunChunks();
+
+		// Les tâches référencent batch : on attend qu'elles soient toutes terminées, en aidant les threads de travail si possible
+		std::unique_lock lock(batch.mutex);
+		while (batch.pendingRunners > 0)
+		{
+			lock.unlock();
+			bool hasRunTask = RunPendingTask();
+			lock.lock();
+
+			if (!hasRunTask)
+				batch.runnersDone.wait(lock, [&] { return batch.pendingRunners == 0; });
+		}
+
+		if (batch.error)
+			std::rethrow_exception(batch.error);
+	}
+
+	bool ThreadPool::RunPendingTask()
+	{
+		std::function<void()> task;
+		{
+			std::lock_guard lock(m_mutex);
+			if (m_tasks.empty())
+				return false;
+
+			task = std::move(m_tasks.front());
+			m_tasks.pop_front();
+		}
+
+		task();
+		return true;
+	}
+
+	void ThreadPool::Submit(std::function<void()> task)
+	{
+		{
+			std::lock_guard lock(m_mutex);
+			m_tasks.push_back(std::move(task));
+		}
+		m_taskAvailable.notify_one();
+	}
+
+	void ThreadPool::WorkerMain()
+	{
+		for (;;)
+		{
+			std::function<void()> task;
+			{
+				std::unique_lock lock(m_mutex);
+				m_taskAvailable.wait(lock, [this] { return m_isStopping || !m_tasks.empty(); });
+
+				// On vide la file avant de s'arrêter
+				if (m_tasks.empty())
+					return;
+
+				task = std::move(m_tasks.front());
+				m_tasks.pop_front();
+			}
+
+			task();
+		}
+	}
+}
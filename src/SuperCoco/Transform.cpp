@@ -1,7 +1,9 @@
 #include <SuperCoco/Transform.hpp>
+#include <SuperCoco/BinarySerializer.hpp>
+#include <SuperCoco/Components/HierarchyComponent.hpp>
+#include <SuperCoco/Systems/HierarchySystem.hpp>
 #include <SuperCoco/WorldEditor.hpp>
 #include <SuperCoco/Maths.hpp>
-#include <SuperCoco/Matrix.hpp>
 #include <SuperCoco/JsonSerializer.hpp>
 #include <SuperCoco/NameComponent.hpp>
 #include <fmt/core.h>
@@ -26,77 +28,99 @@ namespace Sce
 	}
 
 	Transform::Transform() :
-	m_parent(nullptr),
+	m_entity(entt::null),
+	m_registry(nullptr),
 	m_position(0.f, 0.f),
 	m_rotation(0.f),
-	m_scale(1.f, 1.f)
+	m_scale(1.f, 1.f),
+	m_isLocalDirty(true),
+	m_isWorldDirty(true),
+	m_isInvWorldDirty(true),
+	m_hasWorldChanged(true)
 	{
 	}
 
 	Transform::Transform(const Transform& transform) :
-	m_parent(nullptr),
+	m_entity(entt::null),
+	m_registry(nullptr),
 	m_position(transform.m_position),
 	m_rotation(transform.m_rotation),
-	m_scale(transform.m_scale)
+	m_scale(transform.m_scale),
+	m_isLocalDirty(true),
+	m_isWorldDirty(true),
+	m_isInvWorldDirty(true),
+	m_hasWorldChanged(true)
 	{
-		SetParent(transform.m_parent);
 	}
 
 	Transform::Transform(Transform&& transform) noexcept :
-	m_children(std::move(transform.m_children)),
-	m_parent(nullptr),
+	m_entity(transform.m_entity),
+	m_registry(transform.m_registry),
 	m_position(transform.m_position),
 	m_rotation(transform.m_rotation),
-	m_scale(transform.m_scale)
+	m_scale(transform.m_scale),
+	m_localMatrix(transform.m_localMatrix),
+	m_worldMatrix(transform.m_worldMatrix),
+	m_invWorldMatrix(transform.m_invWorldMatrix),
+	m_isLocalDirty(transform.m_isLocalDirty),
+	m_isWorldDirty(transform.m_isWorldDirty),
+	m_isInvWorldDirty(transform.m_isInvWorldDirty),
+	m_hasWorldChanged(transform.m_hasWorldChanged)
 	{
-		SetParent(transform.m_parent);
-		for (Transform* child : m_children)
-		{
-			child->m_parent = this;
-		}
+		// La hirarchie tant porte par l'entit, un dplacement (lorsque EnTT trie ou rorganise son stockage) n'a rien  corriger
+		transform.m_entity = entt::null;
+		transform.m_registry = nullptr;
 	}
 
-	Transform::~Transform()
-	{
-		if (m_parent)
-			m_parent->DetachChild(this);
-
-		for (Transform* child : m_children)
-			child->m_parent = nullptr;
-	}
+	Transform::~Transform() = default; //< le HierarchySystem dtache le Transform lorsque son entit le perd
 
 	Vector2f Transform::GetGlobalPosition() const
 	{
-		if (!m_parent)
+		if (!GetParent())
 			return m_position;
 
-		return m_parent->LocalToWorldPoint(m_position);
+		return LocalToWorldMatrix().GetTranslation();
 	}
 
 	float Transform::GetGlobalRotation() const
 	{
-		if (!m_parent)
+		const Transform* parent = GetParent();
+		if (!parent)
 			return m_rotation;
 
-		return m_parent->GetGlobalRotation() + m_rotation;
+		return parent->GetGlobalRotation() + m_rotation;
 	}
 
 	Vector2f Transform::GetGlobalScale() const
 	{
-		if (!m_parent)
+		const Transform* parent = GetParent();
+		if (!parent)
 			return m_scale;
 
-		return m_parent->GetGlobalScale() * m_scale;
+		return parent->GetGlobalScale() * m_scale;
 	}
 
-	const std::vector<Transform*>& Transform::GetChildren() const
+	entt::entity Transform::GetEntity() const
 	{
-		return m_children;
+		return m_entity;
 	}
 
 	Transform* Transform::GetParent() const
 	{
-		return m_parent;
+		entt::entity parent = GetParentEntity();
+		if (parent == entt::null)
+			return nullptr;
+
+		return &m_registry->get<Transform>(parent);
+	}
+
+	entt::entity Transform::GetParentEntity() const
+	{
+		if (!m_registry)
+			return entt::null;
+
+		const HierarchyComponent* hierarchy = m_registry->try_get<HierarchyComponent>(m_entity);
+		return (hierarchy) ? hierarchy->parent : entt::null;
 	}
 
 	const Vector2f& Transform::GetPosition() const
@@ -136,7 +160,7 @@ namespace Sce
 			bool closePopup = false;
 			if (ImGui::BeginCombo("New parent", "Choose..."))
 			{
-				if (m_parent)
+				if (GetParentEntity() != entt::null)
 				{
 					if (ImGui::Selectable("Unparent"))
 					{
@@ -148,7 +172,7 @@ namespace Sce
 				entt::registry& registry = worldEditor.GetRegistry();
 				for (auto&& [entity, transform] : registry.view<Transform>().each())
 				{
-					if (&transform == this)
+					if (entity == m_entity)
 						continue;
 
 					std::string entityName = fmt::format("Entity #{}", static_cast<std::uint32_t>(entity)); //< On se rappelle qu'un entt::entity est un entier
@@ -176,7 +200,7 @@ namespace Sce
 
 		if (ImGui::TreeNode("Transform matrix"))
 		{
-			Matrixf transformMatrix = GetTransformMatrix3x3();
+			Affine2f transformMatrix = GetTransformMatrix3x3();
 			ImGui::Text("%f %f %f", transformMatrix[Vector2i(0, 0)], transformMatrix[Vector2i(0, 1)], transformMatrix[Vector2i(0, 2)]);
 			ImGui::Text("%f %f %f", transformMatrix[Vector2i(1, 0)], transformMatrix[Vector2i(1, 1)], transformMatrix[Vector2i(1, 2)]);
 			ImGui::Text("%f %f %f", transformMatrix[Vector2i(2, 0)], transformMatrix[Vector2i(2, 1)], transformMatrix[Vector2i(2, 2)]);
@@ -187,54 +211,75 @@ namespace Sce
 	void Transform::Rotate(float rotation)
 	{
 		m_rotation += rotation;
+		InvalidateLocal();
 	}
 
 	void Transform::Scale(float scale)
 	{
 		m_scale *= scale;
+		InvalidateLocal();
 	}
 
 	void Transform::Scale(const Vector2f& scale)
 	{
 		m_scale *= scale;
+		InvalidateLocal();
 	}
 
 	void Transform::SetParent(Transform* parent)
 	{
-		if (m_parent == parent)
+		// Un Transform qui n'est pas (encore) dans un registre n'a pas de HierarchyComponent  modifier, et un parent
+		// d'un autre registre dsignerait une entit sans rapport : on refuse plutt que de corrompre la hirarchie
+		if (!m_registry)
+		{
+			fmt::print(fg(fmt::color::red), "cannot parent a transform which is not attached to a registry\n");
 			return;
+		}
 
-		if (m_parent)
-			m_parent->DetachChild(this);
+		if (parent && parent->m_registry != m_registry)
+		{
+			fmt::print(fg(fmt::color::red), "cannot parent an entity to an entity of another registry\n");
+			return;
+		}
 
-		m_parent = parent;
-		if (m_parent)
-			m_parent->AttachChild(this);
+		if (!HierarchySystem::SetParent(*m_registry, m_entity, (parent) ? parent->m_entity : entt::null))
+			fmt::print(fg(fmt::color::red), "cannot parent an entity to one of its descendants\n");
 	}
 
 	void Transform::SetPosition(const Vector2f& position)
 	{
 		m_position = position;
+		InvalidateLocal();
 	}
 
 	void Transform::SetRotation(const float& rotation)
 	{
 		m_rotation = rotation;
+		InvalidateLocal();
 	}
 
 	void Transform::SetScale(const Vector2f& scale)
 	{
 		m_scale = scale;
+		InvalidateLocal();
 	}
 
 	void Transform::Translate(const Vector2f& translation)
 	{
 		m_position += translation;
+		InvalidateLocal();
 	}
 
-	Matrixf Transform::LocalToWorldMatrix() const
+	const Affine2f& Transform::LocalToWorldMatrix() const
 	{
-		return m_parent ? m_parent->LocalToWorldMatrix() * GetTransformMatrix3x3() : GetTransformMatrix3x3();
+		if (m_isWorldDirty)
+		{
+			const Transform* parent = GetParent();
+			m_worldMatrix = parent ? parent->LocalToWorldMatrix() * GetTransformMatrix3x3() : GetTransformMatrix3x3();
+			m_isWorldDirty = false;
+		}
+
+		return m_worldMatrix;
 	}
 
 	nlohmann::json Transform::Serialize(const entt::handle entity) const
@@ -248,34 +293,54 @@ namespace Sce
 		return doc;
 	}
 
-	Matrixf Transform::GetTransformMatrix3x3() const
+	void Transform::SerializeBinary(BinaryWriter& writer) const
 	{
-		return Matrixf::MakeTransform3x3(m_position, m_rotation, m_scale);
+		writer.Write(m_position);
+		writer.Write(m_rotation);
+		writer.Write(m_scale);
 	}
 
-	Matrixf Transform::LocalToWorld(const Matrixf& other) const
+	const Affine2f& Transform::GetTransformMatrix3x3() const
+	{
+		if (m_isLocalDirty)
+		{
+			m_localMatrix = Affine2f::MakeTransform(m_position, m_rotation, m_scale);
+			m_isLocalDirty = false;
+		}
+
+		return m_localMatrix;
+	}
+
+	Affine2f Transform::LocalToWorld(const Affine2f& other) const
 	{
 		return LocalToWorldMatrix() * other;
 	}
 
 	Vector2f Transform::LocalToWorldPoint(const Vector2f& point) const
 	{
-		return LocalToWorld(Matrixf::MakeFromPosition(point)).GetVector2();
+		return LocalToWorldMatrix().TransformPoint(point);
 	}
 
-	Matrixf Transform::WorldToLocal(const Matrixf& other) const
+	Affine2f Transform::WorldToLocal(const Affine2f& other) const
 	{
 		return WorldToLocalMatrix() * other;
 	}
 
-	Matrixf Transform::WorldToLocalMatrix() const
+	const Affine2f& Transform::WorldToLocalMatrix() const
 	{
-		return m_parent ? m_parent->WorldToLocalMatrix() * GetTransformMatrix3x3().InvertByRowReduction().Split(2) : GetTransformMatrix3x3().InvertByRowReduction().Split(2);
+		// On inverse directement la matrice monde en cache plutt que de remonter toute la hirarchie
+		if (m_isInvWorldDirty)
+		{
+			m_invWorldMatrix = LocalToWorldMatrix().GetInverse();
+			m_isInvWorldDirty = false;
+		}
+
+		return m_invWorldMatrix;
 	}
 
 	Vector2f Transform::WorldToLocalPoint(const Vector2f& point) const
 	{
-		return WorldToLocal(Matrixf::MakeFromPosition(point)).GetVector2();
+		return WorldToLocalMatrix().TransformPoint(point);
 	}
 
 	Transform& Transform::operator=(const Transform& transform)
@@ -283,24 +348,29 @@ namespace Sce
 		m_position = transform.m_position;
 		m_rotation = transform.m_rotation;
 		m_scale = transform.m_scale;
-		SetParent(transform.m_parent);
+		InvalidateLocal();
 
 		return *this;
 	}
 
 	Transform& Transform::operator=(Transform&& transform) noexcept
 	{
-		for (Transform* child : m_children)
-			child->m_parent = nullptr;
-
-		m_children = std::move(transform.m_children);
+		// Comme pour le constructeur de dplacement : l'entit propritaire suit le Transform
+		m_entity = transform.m_entity;
+		m_registry = transform.m_registry;
 		m_position = transform.m_position;
 		m_rotation = transform.m_rotation;
 		m_scale = transform.m_scale;
-		SetParent(transform.m_parent);
+		m_localMatrix = transform.m_localMatrix;
+		m_worldMatrix = transform.m_worldMatrix;
+		m_invWorldMatrix = transform.m_invWorldMatrix;
+		m_isLocalDirty = transform.m_isLocalDirty;
+		m_isWorldDirty = transform.m_isWorldDirty;
+		m_isInvWorldDirty = transform.m_isInvWorldDirty;
+		m_hasWorldChanged = transform.m_hasWorldChanged;
 
-		for (Transform* child : m_children)
-			child->m_parent = this;
+		transform.m_entity = entt::null;
+		transform.m_registry = nullptr;
 
 		return *this;
 	}
@@ -310,17 +380,44 @@ namespace Sce
 		return "Position :\n" + m_position.ToString() + "\nRotation :\n" + std::to_string(m_rotation) + "\nScale :\n" + m_scale.ToString() + "\n";
 	}
 
-	void Transform::AttachChild(Transform* child)
+	void Transform::InvalidateLocal()
 	{
-		m_children.push_back(child);
+		m_isLocalDirty = true;
+		InvalidateWorld();
+	}
+
+	void Transform::InvalidateWorld()
+	{
+		// Si notre matrice monde est dj sale, celles de nos enfants le sont aussi : inutile de redescendre
+		if (m_isWorldDirty && m_isInvWorldDirty)
+			return;
+
+		m_isWorldDirty = true;
+		m_isInvWorldDirty = true;
+		m_hasWorldChanged = true;
+
+		if (!m_registry)
+			return;
+
+		if (const HierarchyComponent* hierarchy = m_registry->try_get<HierarchyComponent>(m_entity))
+		{
+			for (entt::entity child = hierarchy->firstChild; child != entt::null; child = m_registry->get<HierarchyComponent>(child).nextSibling)
+				m_registry->get<Transform>(child).InvalidateWorld();
+		}
 	}
 
-	void Transform::DetachChild(Transform* child)
+	void Transform::Link(entt::registry& registry, entt::entity entity)
 	{
-		auto it = std::find(m_children.begin(), m_children.end(), child);
-		assert(it != m_children.end());
+		m_registry = &registry;
+		m_entity = entity;
 
-		m_children.erase(it);
+		InvalidateWorld();
+	}
+
+	void Transform::Unlink()
+	{
+		m_entity = entt::null;
+		m_registry = nullptr;
 	}
 
 	void Transform::Unserialize(entt::handle entity, const nlohmann::json& doc)
@@ -330,5 +427,15 @@ namespace Sce
 		node.SetRotation(doc.value("Rotation", 0.f));
 		node.SetScale(doc.value("Scale", Vector2f(1.f, 1.f)));
 	}
+
+	Transform Transform::UnserializeBinary(BinaryReader& reader)
+	{
+		Transform transform;
+		transform.m_position = reader.Read<Vector2f>();
+		transform.m_rotation = reader.Read<float>();
+		transform.m_scale = reader.Read<Vector2f>();
+
+		return transform;
+	}
 	
 }
\ No newline at end of file
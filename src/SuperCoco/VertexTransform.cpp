@@ -0,0 +1,156 @@
+#include <SuperCoco/VertexTransform.hpp>
+#include <SuperCoco/Affine2.hpp>
+#include <SuperCoco/Vector2.hpp>
+#include <SDL2/SDL_render.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define SCE_VERTEXTRANSFORM_X86
+	#include <immintrin.h>
+
+	#ifdef _MSC_VER
+		#include <intrin.h>
+		#define SCE_TARGET_AVX2
+	#else
+		#define SCE_TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#endif
+
+namespace Sce
+{
+	static_assert(sizeof(Vector2f) == 2 * sizeof(float), "Vector2f must be tightly packed to be loaded in SIMD registers");
+
+	namespace
+	{
+		void TransformPointsScalar(const Affine2f& matrix, const Vector2f* input, SDL_Vertex* output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				output[i].position.x = matrix.a * input[i].x + matrix.b * input[i].y + matrix.tx;
+				output[i].position.y = matrix.c * input[i].x + matrix.d * input[i].y + matrix.ty;
+			}
+		}
+
+#ifdef SCE_VERTEXTRANSFORM_X86
+		// Deux points par registre : [x0 y0 x1 y1] -> [x0 x0 x1 x1] * [a c a c] + [y0 y0 y1 y1] * [b d b d] + [tx ty tx ty]
+		void TransformPointsSSE2(const Affine2f& matrix, const Vector2f* input, SDL_Vertex* output, std::size_t count)
+		{
+			const __m128 xFactors = _mm_setr_ps(matrix.a, matrix.c, matrix.a, matrix.c);
+			const __m128 yFactors = _mm_setr_ps(matrix.b, matrix.d, matrix.b, matrix.d);
+			const __m128 translation = _mm_setr_ps(matrix.tx, matrix.ty, matrix.tx, matrix.ty);
+
+			const float* in = reinterpret_cast<const float*>(input);
+
+			std::size_t i = 0;
+			for (; i + 2 <= count; i += 2)
+			{
+				__m128 points = _mm_loadu_ps(in + i * 2);
+				__m128 xs = _mm_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+				__m128 ys = _mm_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+				__m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, xFactors), _mm_mul_ps(ys, yFactors)), translation);
+
+				// Les positions des SDL_Vertex ne sont pas contiguës (stride de 20 octets), on les écrit donc deux floats à la fois
+				_mm_storel_pi(reinterpret_cast<__m64*>(&output[i].position), result);
+				_mm_storeh_pi(reinterpret_cast<__m64*>(&output[i + 1].position), result);
+			}
+
+			TransformPointsScalar(matrix, input + i, output + i, count - i);
+		}
+
+		// Même principe que la version SSE2 avec quatre points par registre (le shuffle AVX opère sur chaque moitié de 128 bits)
+		SCE_TARGET_AVX2 void TransformPointsAVX2(const Affine2f& matrix, const Vector2f* input, SDL_Vertex* output, std::size_t count)
+		{
+			const __m256 xFactors = _mm256_setr_ps(matrix.a, matrix.c, matrix.a, matrix.c, matrix.a, matrix.c, matrix.a, matrix.c);
+			const __m256 yFactors = _mm256_setr_ps(matrix.b, matrix.d, matrix.b, matrix.d, matrix.b, matrix.d, matrix.b, matrix.d);
+			const __m256 translation = _mm256_setr_ps(matrix.tx, matrix.ty, matrix.tx, matrix.ty, matrix.tx, matrix.ty, matrix.tx, matrix.ty);
+
+			const float* in = reinterpret_cast<const float*>(input);
+
+			std::size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m256 points = _mm256_loadu_ps(in + i * 2);
+				__m256 xs = _mm256_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+				__m256 ys = _mm256_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+				__m256 result = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(xs, xFactors), _mm256_mul_ps(ys, yFactors)), translation);
+
+				__m128 low = _mm256_castps256_ps128(result);
+				__m128 high = _mm256_extractf128_ps(result, 1);
+				_mm_storel_pi(reinterpret_cast<__m64*>(&output[i].position), low);
+				_mm_storeh_pi(reinterpret_cast<__m64*>(&output[i + 1].position), low);
+				_mm_storel_pi(reinterpret_cast<__m64*>(&output[i + 2].position), high);
+				_mm_storeh_pi(reinterpret_cast<__m64*>(&output[i + 3].position), high);
+			}
+
+			TransformPointsSSE2(matrix, input + i, output + i, count - i);
+		}
+#endif
+
+		SimdLevel DetectSimdLevel()
+		{
+#if defined(SCE_VERTEXTRANSFORM_X86) && defined(_MSC_VER)
+			int cpuInfo[4];
+			__cpuid(cpuInfo, 0);
+			int maxLeaf = cpuInfo[0];
+
+			__cpuid(cpuInfo, 1);
+			bool hasSSE2 = (cpuInfo[3] & (1 << 26)) != 0;
+			bool hasOSXSave = (cpuInfo[2] & (1 << 27)) != 0;
+			bool hasAVX = (cpuInfo[2] & (1 << 28)) != 0;
+
+			// L'AVX n'est utilisable que si l'OS sauvegarde les registres YMM lors des changements de contexte
+			if (maxLeaf >= 7 && hasOSXSave && hasAVX && (_xgetbv(0) & 0x6) == 0x6)
+			{
+				__cpuidex(cpuInfo, 7, 0);
+				if (cpuInfo[1] & (1 << 5))
+					return SimdLevel::AVX2;
+			}
+
+			return (hasSSE2) ? SimdLevel::SSE2 : SimdLevel::Scalar;
+#elif defined(SCE_VERTEXTRANSFORM_X86)
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2"))
+				return SimdLevel::AVX2;
+
+			return (__builtin_cpu_supports("sse2")) ? SimdLevel::SSE2 : SimdLevel::Scalar;
+#else
+			return SimdLevel::Scalar;
+#endif
+		}
+	}
+
+	void TransformPoints(const Affine2f& matrix, const Vector2f* input, SDL_Vertex* output, std::size_t count)
+	{
+		static const SimdLevel s_simdLevel = GetSupportedSimdLevel();
+		TransformPoints(s_simdLevel, matrix, input, output, count);
+	}
+
+	void TransformPoints(SimdLevel level, const Affine2f& matrix, const Vector2f* input, SDL_Vertex* output, std::size_t count)
+	{
+		static const SimdLevel s_supportedLevel = GetSupportedSimdLevel();
+		if (level > s_supportedLevel)
+			level = s_supportedLevel;
+
+		switch (level)
+		{
+#ifdef SCE_VERTEXTRANSFORM_X86
+			case SimdLevel::AVX2:
+				TransformPointsAVX2(matrix, input, output, count);
+				return;
+
+			case SimdLevel::SSE2:
+				TransformPointsSSE2(matrix, input, output, count);
+				return;
+#endif
+
+			default:
+				TransformPointsScalar(matrix, input, output, count);
+				return;
+		}
+	}
+
+	SimdLevel GetSupportedSimdLevel()
+	{
+		static const SimdLevel s_simdLevel = DetectSimdLevel();
+		return s_simdLevel;
+	}
+}
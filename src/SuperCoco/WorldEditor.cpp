@@ -1,7 +1,10 @@
 #include <SuperCoco/WorldEditor.hpp>
 #include <SuperCoco/Components/CameraComponent.hpp>
+#include <SuperCoco/Components/HierarchyComponent.hpp>
 #include <SuperCoco/ComponentRegistry.hpp>
 #include <SuperCoco/NameComponent.hpp>
+#include <SuperCoco/SceneSerializer.hpp>
+#include <SuperCoco/Systems/SpatialSystem.hpp>
 #include <SuperCoco/Transform.hpp>
 #include <SuperCoco/Vector2.hpp>
 #include <SuperCoco/Window.hpp>
@@ -15,9 +18,10 @@ namespace Sce
 {
 	constexpr unsigned int FileVersion = 1;
 
-	WorldEditor::WorldEditor(Window& window, entt::registry& registry, const ComponentRegistry& componentRegistry) :
+	WorldEditor::WorldEditor(Window& window, entt::registry& registry, const ComponentRegistry& componentRegistry, const SpatialSystem& spatialSystem) :
 	m_registry(registry),
 	m_componentRegistry(componentRegistry),
+	m_spatialSystem(spatialSystem),
 	m_window(window),
 	m_isPaused(false)
 	{
@@ -54,6 +58,10 @@ namespace Sce
 		}
 		ImGui::End();
 
+		// Double-cliquer sur une entité dans le monde l'ouvre dans l'inspecteur (sauf si la souris est sur une fenêtre ImGui)
+		if (!ImGui::GetIO().WantCaptureMouse && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
+			PickEntityUnderMouse();
+
 		// Pattern permettant d'itérer sur un vector tout en supprimant conditionnellement des entités
 		for (auto it = m_inspectedEntities.begin(); it != m_inspectedEntities.end();)
 		{
@@ -157,20 +165,20 @@ namespace Sce
 
 		// Affichage de la hiérarchie
 		// (il est 2h23 du matin donc excusez la duplication de code)
-		if (Transform* transform = m_registry.try_get<Transform>(entity))
+		if (const HierarchyComponent* hierarchy = m_registry.try_get<HierarchyComponent>(entity))
 		{
-			const std::vector<Transform*>& childTransforms = transform->GetChildren();
-
-			ImGuiTreeNodeFlags nodeFlags = (childTransforms.empty()) ? ImGuiTreeNodeFlags_Leaf : 0;
+			ImGuiTreeNodeFlags nodeFlags = (hierarchy->firstChild == entt::null) ? ImGuiTreeNodeFlags_Leaf : 0;
 			if (ImGui::TreeNodeEx(entityName.c_str(), nodeFlags))
 			{
 				HandleContextMenu();
 
-				for (Transform* childTransform : childTransforms)
+				// Le menu contextuel d'un enfant peut détruire celui-ci : on relit les liens depuis le registre à chaque étape
+				entt::entity childEntity = m_registry.get<HierarchyComponent>(entity).firstChild;
+				while (childEntity != entt::null)
 				{
-					entt::entity childEntity = GetEntity(childTransform);
-					if (childEntity != entt::null)
-						DisplayEntityListNode(childEntity);
+					entt::entity nextEntity = m_registry.get<HierarchyComponent>(childEntity).nextSibling;
+					DisplayEntityListNode(childEntity);
+					childEntity = nextEntity;
 				}
 
 				ImGui::TreePop();
@@ -289,23 +297,17 @@ namespace Sce
 		return entt::null;
 	}
 
-	entt::entity WorldEditor::GetEntity(Transform* transform)
+	void WorldEditor::LoadScene()
 	{
-		// On recherche l'entité possédant le composant Transform
-		// on aurait pu faire différemment (stocker l'entité propriétaire dans le Transform, faire une map)
-		// mais dans notre cas ça ne posera pas de problème de performance (et il est 2h25 du matin)
-
-		for (auto&& [entity, entityTransform] : m_registry.view<Transform>().each())
+		if (m_scenePath.ends_with(".bscene"))
 		{
-			if (&entityTransform == transform) //< on compare les pointeurs
-				return entity;
-		}
+			// La scène ouverte n'est remplacée qu'une fois le fichier entièrement décodé
+			if (!SceneSerializer::LoadBinary(m_registry, m_componentRegistry, m_scenePath, true))
+				fmt::print(fg(fmt::color::red), "{} was not loaded, the current scene is kept\n", m_scenePath);
 
-		return entt::null; //< ne devrait pas arriver
-	}
+			return;
+		}
 
-	void WorldEditor::LoadScene()
-	{
 		std::ifstream inputFile(m_scenePath);
 		if (!inputFile)
 		{
@@ -334,7 +336,8 @@ namespace Sce
 		}
 
 		// On réinitialise le monde pour créer les entités du document
-		m_registry = entt::registry{};
+		// (clear plutôt qu'une réaffectation pour conserver les signaux connectés par les systèmes)
+		m_registry.clear();
 
 		std::vector<entt::entity> indexToEntity;
 		for (const nlohmann::json& entityDoc : sceneDoc["Entities"])
@@ -366,8 +369,33 @@ namespace Sce
 
 	}
 
+	void WorldEditor::PickEntityUnderMouse()
+	{
+		entt::entity camera = GetCameraEntity();
+		if (camera == entt::null)
+			return;
+
+		ImVec2 mousePos = ImGui::GetIO().MousePos;
+		Vector2f worldPos = m_registry.get<Transform>(camera).LocalToWorldPoint(Vector2f(mousePos.x, mousePos.y));
+
+		entt::entity entity = m_spatialSystem.PickEntity(worldPos);
+		if (entity == entt::null)
+			return;
+
+		if (std::find(m_inspectedEntities.begin(), m_inspectedEntities.end(), entity) == m_inspectedEntities.end())
+			m_inspectedEntities.push_back(entity);
+	}
+
 	void WorldEditor::SaveScene()
 	{
+		if (m_scenePath.ends_with(".bscene"))
+		{
+			if (SceneSerializer::SaveBinary(m_registry, m_componentRegistry, m_scenePath))
+				fmt::print(fg(fmt::color::green), "scene saved to {}\n", m_scenePath);
+
+			return;
+		}
+
 		std::ofstream fileStream(m_scenePath);
 		if (!fileStream)
 		{
@@ -400,11 +428,9 @@ namespace Sce
 
 			if (Transform* transform = entityHandle.try_get<Transform>())
 			{
-				if (Transform* parentTransform = transform->GetParent())
-				{
-					entt::entity parentEntity = GetEntity(parentTransform); 
+				entt::entity parentEntity = transform->GetParentEntity();
+				if (parentEntity != entt::null)
 					hierarchies.push_back({ parentEntity, entity });
-				}
 			}
 
 			entityToIndex[entity] = entityArray.size();
@@ -0,0 +1,53 @@
+#include <SuperCoco/AssetArchive.hpp>
+#include <fmt/color.h>
+#include <fmt/core.h>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Regroupe des ressources dans une archive (.scpak) à monter avec ResourceManager::MountArchive
+// usage: SceAssetPacker <archive.scpak> <fichier ou dossier>... [--no-compress]
+int main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		fmt::print("usage: {} <archive.scpak> <file or directory>... [--no-compress]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::string archivePath = argv[1];
+	bool compressTextFiles = true;
+
+	std::vector<std::string> filepaths;
+	for (int i = 2; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--no-compress")
+		{
+			compressTextFiles = false;
+			continue;
+		}
+
+		// Comme pour SceAtlasBuilder, les chemins sont stockés tels quels : ils doivent correspondre à ceux passés au ResourceManager
+		if (std::filesystem::is_directory(arg))
+		{
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(arg))
+			{
+				if (entry.is_regular_file())
+					filepaths.push_back(entry.path().generic_string());
+			}
+		}
+		else
+			filepaths.push_back(arg);
+	}
+
+	if (!Sce::AssetArchive::BuildToFile(filepaths, archivePath, compressTextFiles))
+	{
+		fmt::print(fg(fmt::color::red), "failed to build archive {}\n", archivePath);
+		return EXIT_FAILURE;
+	}
+
+	fmt::print("packed {} files into {}\n", filepaths.size(), archivePath);
+	return EXIT_SUCCESS;
+}
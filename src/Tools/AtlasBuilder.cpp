@@ -0,0 +1,59 @@
+#include <SuperCoco/TextureAtlas.hpp>
+#include <fmt/color.h>
+#include <fmt/core.h>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Construit hors-ligne un atlas de textures (pages .png + manifeste JSON) à charger avec ResourceManager::LoadTextureAtlas
+// usage: SceAtlasBuilder <manifest.json> <image ou dossier>... [--page-size N] [--padding N]
+int main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		fmt::print("usage: {} <manifest.json> <image or directory>... [--page-size N] [--padding N]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::string manifestPath = argv[1];
+	int pageSize = 2048;
+	int padding = 1;
+
+	std::vector<std::string> texturePaths;
+	for (int i = 2; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if ((arg == "--page-size" || arg == "--padding") && i + 1 < argc)
+		{
+			int value = std::atoi(argv[++i]);
+			if (arg == "--page-size")
+				pageSize = value;
+			else
+				padding = value;
+
+			continue;
+		}
+
+		// Les chemins sont stockés tels quels dans le manifeste : ils doivent correspondre à ceux passés à ResourceManager::GetTexture
+		if (std::filesystem::is_directory(arg))
+		{
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(arg))
+			{
+				if (entry.is_regular_file() && entry.path().extension() == ".png")
+					texturePaths.push_back(entry.path().generic_string());
+			}
+		}
+		else
+			texturePaths.push_back(arg);
+	}
+
+	if (!Sce::TextureAtlas::BuildToFile(texturePaths, manifestPath, pageSize, padding))
+	{
+		fmt::print(fg(fmt::color::red), "failed to build atlas {}\n", manifestPath);
+		return EXIT_FAILURE;
+	}
+
+	fmt::print("packed {} textures into {}\n", texturePaths.size(), manifestPath);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,45 @@
+#include <SuperCoco/Model.hpp>
+#include <fmt/color.h>
+#include <fmt/core.h>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Convertit des modèles (.model, .cmodel ou ancien .bmodel) au format binaire v2, à côté des fichiers d'origine
+// usage: SceModelConverter <modèle>... [--no-compress]
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		fmt::print("usage: {} <model>... [--no-compress]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	bool compress = true;
+	std::vector<std::string> modelPaths;
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--no-compress")
+			compress = false;
+		else
+			modelPaths.push_back(std::move(arg));
+	}
+
+	int failureCount = 0;
+	for (const std::string& modelPath : modelPaths)
+	{
+		std::string outputPath = std::filesystem::path(modelPath).replace_extension(".bmodel").generic_string();
+		if (!Sce::Model::ConvertToBinary(modelPath, outputPath, compress))
+		{
+			fmt::print(fg(fmt::color::red), "failed to convert {}\n", modelPath);
+			failureCount++;
+			continue;
+		}
+
+		fmt::print("{} -> {}\n", modelPath, outputPath);
+	}
+
+	return (failureCount == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -4,6 +4,9 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include <entt/entt.hpp>
+#include <array>
+#include <cmath>
+#include <filesystem>
 #include <memory>
 #include <vector>
 
@@ -22,15 +25,27 @@
 #include <SuperCoco/Model.hpp>
 #include <SuperCoco/ComponentRegistry.hpp>
 #include <SuperCoco/TimerManager.hpp>
+#include <SuperCoco/EntityCommandBuffer.hpp>
+#include <SuperCoco/EntityPool.hpp>
+#include <SuperCoco/SystemScheduler.hpp>
+#include <SuperCoco/ThreadPool.hpp>
 #include <SuperCoco/Maths.hpp>
+#include <SuperCoco/Systems/HierarchySystem.hpp>
 #include <SuperCoco/Systems/RenderSystem.hpp>
+#include <SuperCoco/Systems/SpatialSystem.hpp>
 #include <SuperCoco/Systems/VelocitySystem.hpp>
 #include <SuperCoco/Systems/GravitySystem.hpp>
+#include <SuperCoco/Systems/KinematicsSystem.hpp>
 #include <SuperCoco/Systems/AnimationSystem.hpp>
+#include <SuperCoco/Systems/AssetLoadingSystem.hpp>
 #include <SuperCoco/Systems/PhysicsSystem.hpp>
 #include <SuperCoco/Components/VelocityComponent.hpp>
 #include <SuperCoco/Components/GraphicsComponent.hpp>
 #include <SuperCoco/Components/CameraComponent.hpp>
+#include <SuperCoco/Components/HierarchyComponent.hpp>
+#include <SuperCoco/Components/KinematicsComponents.hpp>
+#include <SuperCoco/Components/PoolComponents.hpp>
+#include <SuperCoco/Components/PendingModelComponent.hpp>
 #include <SuperCoco/Components/SpritesheetComponent.hpp>
 #include <SuperCoco/Components/RigidBodyComponent.hpp>
 #include <SuperCoco/Components/TextComponent.hpp>
@@ -38,6 +53,7 @@
 #pragma endregion
 #include <BulletForge/Game.hpp>
 #include <BulletForge/HealthComponent.hpp>
+#include <BulletForge/DeathComponent.hpp>
 #include <BulletForge/DeathSystem.hpp>
 
 #ifdef WITH_SCE_EDITOR
@@ -65,14 +81,26 @@ int main(int argc, char* argv[])
 #ifdef WITH_SCE_EDITOR
 	Sce::ImGuiRenderer imgui(window, renderer);
 	ImGui::SetCurrentContext(imgui.GetContext());
+
+	rcmgr.EnableHotReload();
+#else
+	// Les builds de distribution lisent leurs ressources depuis l'archive construite par SceAssetPacker
+	if (std::filesystem::exists("assets.scpak"))
+		rcmgr.MountArchive("assets.scpak");
 #endif
 
 	entt::registry world;
-	Sce::RenderSystem renderSystem(&world, &renderer);
-	Sce::VelocitySystem velocitySystem(&world);
-	Sce::GravitySystem gravitySystem(&world);
-	Sce::AnimationSystem animationSystem(&world);
+	Sce::ThreadPool systemThreadPool; //< partagé par le SystemScheduler et les systèmes qui découpent leur parcours
+	Sce::HierarchySystem hierarchySystem(&world, &systemThreadPool);
+	Sce::RenderSystem renderSystem(&world, &renderer, &window);
+	Sce::SpatialSystem spatialSystem(&world);
+	Sce::VelocitySystem velocitySystem(&world, &systemThreadPool);
+	Sce::GravitySystem gravitySystem(&world, &systemThreadPool);
+	Sce::KinematicsSystem kinematicsSystem(&world, &systemThreadPool);
+	Sce::AnimationSystem animationSystem(&world, &systemThreadPool);
+	Sce::AssetLoadingSystem assetLoadingSystem(&world);
 	Sce::PhysicsSystem physicSystem(world);
+	Sce::EntityCommandBuffer commandBuffer(world); //< modifications structurelles différées, appliquées par le système "Commands"
 
 	Sce::ComponentRegistry componentRegistry;
 
@@ -81,38 +109,93 @@ int main(int argc, char* argv[])
 #endif
 #pragma endregion
 
-	BulletForge::Game game;
-	BulletForge::DeathSystem deathSystem(&world);
+	BulletForge::Game game(componentRegistry);
+	BulletForge::DeathSystem deathSystem(&world, &commandBuffer);
+
+	// Chaque système déclare les composants qu'il lit et écrit, ceux qui ne sont pas en conflit s'exécutent en parallèle
+	Sce::SystemScheduler systemScheduler(world, systemThreadPool);
+	systemScheduler.AddSystem("Timers", [&](float deltaTime) { timermgr.UpdateTimers(deltaTime); })
+		.Exclusive(); //< les callbacks des timers accèdent à n'importe quel composant
+	systemScheduler.AddSystem("AssetLoading", [&](float /*deltaTime*/) { assetLoadingSystem.Update(); })
+		.RunOnMainThread() //< les AssetHandle ne sont mis à jour que par ResourceManager::Update
+		.Writes<Sce::PendingModelComponent, Sce::GraphicsComponent, Sce::InactiveComponent>();
+	systemScheduler.AddSystem("Animation", [&](float deltaTime) { animationSystem.Update(deltaTime); })
+		.Reads<Sce::InactiveComponent>()
+		.Writes<Sce::SpritesheetComponent, Sce::GraphicsComponent>(); //< le sprite animé est celui du GraphicsComponent
+	systemScheduler.AddSystem("Gravity", [&](float deltaTime) { gravitySystem.ApplyGravity(deltaTime); })
+		.Reads<Sce::InactiveComponent>()
+		.Writes<Sce::VelocityComponent>();
+	systemScheduler.AddSystem("Velocity", [&](float deltaTime) { velocitySystem.ApplyVelocity(deltaTime); })
+		.Reads<Sce::HierarchyComponent, Sce::InactiveComponent>() //< déplacer un Transform invalide ses enfants
+		.Writes<Sce::Transform, Sce::VelocityComponent>();
+	systemScheduler.AddSystem("Kinematics", [&](float deltaTime) { kinematicsSystem.Update(deltaTime); })
+		.Reads<Sce::HierarchyComponent, Sce::GraphicsComponent, Sce::InactiveComponent, Sce::KinematicAccelerationX, Sce::KinematicAccelerationY>()
+		.Writes<Sce::Transform, Sce::KinematicPositionX, Sce::KinematicPositionY, Sce::KinematicVelocityX, Sce::KinematicVelocityY>();
+	systemScheduler.AddSystem("Physics", [&](float deltaTime) { physicSystem.Update(deltaTime); })
+		.Exclusive(); //< les callbacks de collision accèdent à n'importe quel composant
+	systemScheduler.AddSystem("Death", [&](float /*deltaTime*/) { deathSystem.DeathNote(); })
+		.Reads<BulletForge::DeathComponent, Sce::PooledComponent>(); //< les entités issues d'un pool y sont rendues au lieu d'être détruites
+	systemScheduler.AddSystem("Commands", [&](float /*deltaTime*/) { commandBuffer.Playback(); })
+		.Exclusive(); //< point de synchronisation : applique les créations/destructions enregistrées pendant la frame
+	systemScheduler.AddSystem("Hierarchy", [&](float /*deltaTime*/) { hierarchySystem.Update(); })
+		.Reads<Sce::InactiveComponent>()
+		.Writes<Sce::Transform, Sce::HierarchyComponent>();
+	systemScheduler.AddSystem("Spatial", [&](float /*deltaTime*/) { spatialSystem.Update(hierarchySystem.GetMovedEntities()); })
+		.Reads<Sce::Transform, Sce::HierarchyComponent, Sce::GraphicsComponent>();
+	systemScheduler.AddSystem("Render", [&](float deltaTime) { renderSystem.Render(deltaTime); })
+		.RunOnMainThread()
+		.Reads<Sce::Transform, Sce::HierarchyComponent, Sce::GraphicsComponent, Sce::CameraComponent>();
 
 	#pragma region ENTITIES
 	entt::handle camera = core.CreateCamera(world, { -1080.f / 2.f, -769.f / 2.f }, {1.f, 1.f});
 
 	entt::handle Player = game.CreatePlayer(world, renderer, { (1080.f / 2.f) * 1.5f, (769.f / 2.f) * 1.5f }, 1);
-	Sce::Transform* pTransform = &Player.get<Sce::Transform>();
 	Sce::RigidBodyComponent* rb = &Player.get<Sce::RigidBodyComponent>();
 	Sce::SpritesheetComponent* pSheet = &Player.get<Sce::SpritesheetComponent>();
 
 	entt::handle sword = game.CreateWeapon(world, renderer, { 16 * 10, 16 * 8, 16, 16 }, { (1080.f / 2.f) * 1.5f, (769.f / 2.f) * 1.5f }, {0.f, 0.f}, 2);
 	Sce::RigidBodyComponent* swordrb = &sword.get<Sce::RigidBodyComponent>();
 
-	timermgr.CreateTimer(5.f, [&world, &renderer, &game, &core, &pTransform]()
+	timermgr.CreateTimer(5.f, [&renderer, &game, &core, &commandBuffer, Player]()
 		{
+			// Une vague d'ennemis du même type en cercle autour du joueur, sortie du pool (ou créée) en un seul lot
+			constexpr std::size_t WaveSize = 6;
+
 			BulletForge::EnemyType enemyType = static_cast<BulletForge::EnemyType>(std::rand() % 5);
-			Sce::Vector2f pos = pTransform->GetPosition();
-			pos.x += static_cast<float>(-300 + std::rand() % 601);
-			pos.y += static_cast<float>(-300 + std::rand() % 601);
-			entt::handle enemy = game.CreateEnemy(world, renderer, enemyType, pos, 1, core);
-			Sce::Transform* eTransform = &enemy.get<Sce::Transform>();
-			eTransform->SetScale({ 0.f,0.f });
-			Sce::TimerManager::CreateContinuousTimer(0.75f, [enemy](float delta, float current)
+			Sce::Vector2f center = Player.get<Sce::Transform>().GetPosition();
+			float startAngle = static_cast<float>(std::rand() % 360);
+
+			std::array<Sce::Vector2f, WaveSize> positions;
+			for (std::size_t i = 0; i < WaveSize; ++i)
+			{
+				float angle = (startAngle + i * 360.f / WaveSize) * Deg2Rad;
+				float radius = static_cast<float>(250 + std::rand() % 101);
+				positions[i] = center + Sce::Vector2f(std::cos(angle), std::sin(angle)) * radius;
+			}
+
+			commandBuffer.Defer([&renderer, &game, &core, &commandBuffer, enemyType, positions](entt::registry& registry)
+			{
+				std::vector<entt::entity> enemies = game.CreateEnemies(registry, renderer, enemyType, positions, 1, core, commandBuffer);
+				for (entt::entity enemyEntity : enemies)
 				{
-					Sce::Transform* eTransform = &enemy.get<Sce::Transform>();
-					float progress = Sce::Maths::EaseOutBack(current / 0.75f);
-					eTransform->SetScale({ progress, progress });
-				});
+					entt::handle enemy(registry, enemyEntity);
+					enemy.get<Sce::Transform>().SetScale({ 0.f,0.f });
+					std::uint32_t generation = Sce::EntityPool::GetGeneration(registry, enemyEntity);
+					Sce::TimerManager::CreateContinuousTimer(0.75f, [enemy, generation](float delta, float current)
+					{
+						// Un ennemi mort pendant son apparition est rendu à son pool, et peut en être ressorti (même identifiant) avant la fin du timer
+						if (!Sce::EntityPool::IsAlive(*enemy.registry(), enemy.entity(), generation))
+							return;
+
+						Sce::Transform* eTransform = &enemy.get<Sce::Transform>();
+						float progress = Sce::Maths::EaseOutBack(current / 0.75f);
+						eTransform->SetScale({ progress, progress });
+					});
+				}
+			});
 		}, 0.f, true);
 
-	camera.get<Sce::Transform>().SetParent(pTransform);
+	camera.get<Sce::Transform>().SetParent(&Player.get<Sce::Transform>());
 
 	#pragma endregion
 
@@ -126,7 +209,7 @@ int main(int argc, char* argv[])
 	inputmgr.BindControllerAxis(SDL_CONTROLLER_AXIS_TRIGGERLEFT, "rotateLeft");
 	inputmgr.BindControllerAxis(SDL_CONTROLLER_AXIS_TRIGGERRIGHT, "rotateRight");
 	
-	inputmgr.BindAction("moveX", [&moveInput, &rb, &pSheet](bool active, int, float value)
+	inputmgr.BindAction("moveX", [&moveInput, &rb, &pSheet, Player](bool active, int, float value)
 		{
 			if (!active)
 				return;
@@ -138,7 +221,8 @@ int main(int argc, char* argv[])
 				pSheet->m_targetSprite.get()->Resize(-48, 48);
 			else
 				pSheet->m_targetSprite.get()->Resize(48, 48);
-			
+
+			Player.patch<Sce::GraphicsComponent>(); //< les bornes du sprite ont changé
 		});
 	inputmgr.BindAction("moveY", [&moveInput, &rb](bool active, int, float value)
 		{
@@ -177,7 +261,7 @@ int main(int argc, char* argv[])
 		}
 		else
 		{
-			worldEditor.emplace(window, world, componentRegistry);
+			worldEditor.emplace(window, world, componentRegistry, spatialSystem);
 		}
 	});
 	#endif
@@ -211,6 +295,7 @@ int main(int argc, char* argv[])
 		}
 
 		core.Update();
+		rcmgr.Update();
 		renderer.RenderDrawColor(100, 0, 0, 0);
 		renderer.RenderClear();
 
@@ -220,22 +305,37 @@ int main(int argc, char* argv[])
 
 		swordrb->TeleportTo(rb->GetPosition()); // <- C'est degueulasse mais vas-y il est 3h31 du matin, j'entends les oiseaux chanter
 
-		timermgr.UpdateTimers(deltaTime);
-		animationSystem.Update(deltaTime);
-		gravitySystem.ApplyGravity(deltaTime);
-		velocitySystem.ApplyVelocity(deltaTime);
-		physicSystem.Update(deltaTime);
-
-		deathSystem.DeathNote();
-
-		renderSystem.Render(deltaTime);
+		systemScheduler.Run(deltaTime);
 
 #ifdef WITH_SCE_EDITOR
 		physicSystem.DebugDraw(renderer, core.GetCameraTransform(world).WorldToLocalMatrix());
 
 		if (worldEditor)
+		{
 			worldEditor->Render();
 
+			const Sce::Renderer::FrameStats& renderStats = renderer.GetFrameStats();
+			ImGui::Begin("Render stats");
+			ImGui::Text("Draw calls: %zu (%zu geometries submitted)", renderStats.drawCalls, renderStats.submittedGeometries);
+			ImGui::Text("Vertices: %zu / Indices: %zu", renderStats.vertexCount, renderStats.indexCount);
+
+			const Sce::RenderSystem::CullingStats& cullingStats = renderSystem.GetCullingStats();
+			ImGui::Text("Visible: %zu / Culled: %zu", cullingStats.visibleCount, cullingStats.culledCount);
+			ImGui::Text("Pending loads: %zu", rcmgr.GetPendingLoadCount());
+
+			const Sce::ResourceManager::MemoryStats memoryStats = rcmgr.GetMemoryStats();
+			ImGui::Text("Resources: %.1f MiB", memoryStats.GetTotal() / (1024.f * 1024.f));
+			ImGui::Text("  Textures: %.1f MiB / Models: %.1f MiB", memoryStats.textureBytes / (1024.f * 1024.f), memoryStats.modelBytes / (1024.f * 1024.f));
+			ImGui::Text("  Fonts: %.1f MiB / Spritesheets: %.1f KiB", memoryStats.fontBytes / (1024.f * 1024.f), memoryStats.spritesheetBytes / 1024.f);
+			ImGui::Text("  Pinned atlas: %.1f MiB (budget: %.1f MiB)", memoryStats.pinnedBytes / (1024.f * 1024.f), rcmgr.GetMemoryBudget() / (1024.f * 1024.f));
+
+			const Sce::EntityPool::Stats enemyPoolStats = game.GetEnemyPoolStats();
+			const Sce::EntityPool::Stats hitTextPoolStats = game.GetHitTextPoolStats();
+			ImGui::Text("Enemy pool: %.0f%% hits (%zu/%zu), %zu pooled", enemyPoolStats.GetHitRate() * 100.f, enemyPoolStats.hitCount, enemyPoolStats.acquireCount, enemyPoolStats.pooledCount);
+			ImGui::Text("Hit text pool: %.0f%% hits (%zu/%zu), %zu pooled", hitTextPoolStats.GetHitRate() * 100.f, hitTextPoolStats.hitCount, hitTextPoolStats.acquireCount, hitTextPoolStats.pooledCount);
+			ImGui::End();
+		}
+
 		imgui.Render(renderer);
 #endif
 
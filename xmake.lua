@@ -39,6 +39,9 @@ target("SuperCocoEngine")
     add_packages("lz4")
     add_defines("SUPER_COCO_BUILD")
     add_includedirs("src")
+    if is_plat("linux", "bsd") then
+        add_syslinks("pthread")
+    end
 
 target("Bullet Forge")
     set_kind("binary")
@@ -57,6 +60,48 @@ target("SceTest")
     add_files("src/test.cpp")
     add_deps("SuperCocoEngine")
     add_packages("chipmunk2d","nlohmann_json", "openal-soft")
+
+target("SceAtlasBuilder")
+    set_kind("binary")
+    set_group("Tools")
+    add_files("src/Tools/AtlasBuilder.cpp")
+    add_deps("SuperCocoEngine")
+
+target("SceAssetPacker")
+    set_kind("binary")
+    set_group("Tools")
+    add_files("src/Tools/AssetPacker.cpp")
+    add_deps("SuperCocoEngine")
+
+target("SceModelConverter")
+    set_kind("binary")
+    set_group("Tools")
+    add_files("src/Tools/ModelConverter.cpp")
+    add_deps("SuperCocoEngine")
+
+target("SceBenchTransformPoints")
+    set_kind("binary")
+    set_group("Benchmarks")
+    add_files("src/Benchmarks/TransformPoints.cpp")
+    add_deps("SuperCocoEngine")
+
+target("SceBenchParallelForEach")
+    set_kind("binary")
+    set_group("Benchmarks")
+    add_files("src/Benchmarks/ParallelForEach.cpp")
+    add_deps("SuperCocoEngine")
+
+target("SceBenchKinematics")
+    set_kind("binary")
+    set_group("Benchmarks")
+    add_files("src/Benchmarks/Kinematics.cpp")
+    add_deps("SuperCocoEngine")
+
+target("SceBenchSceneLoading")
+    set_kind("binary")
+    set_group("Benchmarks")
+    add_files("src/Benchmarks/SceneLoading.cpp")
+    add_deps("SuperCocoEngine")
 --
 -- If you want to known more usage about xmake, please see https://xmake.io
 --